@@ -0,0 +1,372 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#include "itertools.hpp"
+#include "itertools_sort.hpp"
+#include "itertools_join.hpp"
+
+#include <vector>
+#include <map>
+#include <list>
+#include <unordered_map>
+#include <string>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <utility>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <type_traits>
+
+#ifdef __cpp_concepts
+#include <ranges>
+#endif
+
+/**
+ * @details
+ * Benchmarks of the zipped loops against the hand-written ones.\n
+ * Every case is run several times, the best run is reported as\n
+ * ns per element and bytes of the columns' data per element.\n
+ * Run it as\n
+ * zip_in_cpp_bench [elements]\n
+ * */
+
+namespace bench {
+
+  template<typename T>
+  inline void doNotOptimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+	  asm volatile("" : : "r,m"(value) : "memory");
+#else
+	  static volatile T const* sink;
+	  sink = &value;
+#endif
+  }
+
+  inline constexpr int repetitions {7};
+
+  template<typename Prepare, typename Run>
+  void measure(std::string const& name, std::size_t elements, std::size_t bytes_per_element, Prepare prepare, Run run) {
+	  using Clock = std::chrono::steady_clock;
+	  double best {std::numeric_limits<double>::max()};
+	  for (int r = 0; r != repetitions; ++r) {
+		  prepare();
+		  auto const start {Clock::now()};
+		  run();
+		  auto const finish {Clock::now()};
+		  best = std::min(best, std::chrono::duration<double, std::nano>(finish - start).count());
+	  }
+	  std::cout << std::left << std::setw(44) << name
+				<< std::right << std::fixed << std::setprecision(3)
+				<< std::setw(10) << best / static_cast<double>(elements) << " ns/elem"
+				<< std::setw(8) << bytes_per_element << " B/elem\n";
+  }
+
+  template<typename Run>
+  void measure(std::string const& name, std::size_t elements, std::size_t bytes_per_element, Run run) {
+	  measure(name, elements, bytes_per_element, []{}, run);
+  }
+
+  using Column = std::vector<std::int64_t>;
+  inline constexpr std::size_t max_ways {16u};
+
+  template<std::size_t... I>
+  void vectorsWays(std::array<Column, max_ways> const& columns, std::index_sequence<I...>) {
+	  constexpr auto ways {sizeof...(I)};
+	  auto const n {columns[0].size()};
+	  auto const bytes {ways * sizeof(std::int64_t)};
+
+	  measure("vector x" + std::to_string(ways) + " zip", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (auto const& row : itertools::zip(columns[I]...)) {
+			  acc += std::apply([](auto const&... x) { return (x + ...); }, row);
+		  }
+		  doNotOptimize(acc);
+	  });
+	  measure("vector x" + std::to_string(ways) + " indexed", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (std::size_t i = 0; i != n; ++i) {
+			  acc += (columns[I][i] + ...);
+		  }
+		  doNotOptimize(acc);
+	  });
+#ifdef __cpp_lib_ranges_zip
+	  measure("vector x" + std::to_string(ways) + " std::views::zip", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (auto const& row : std::views::zip(columns[I]...)) {
+			  acc += std::apply([](auto const&... x) { return (x + ...); }, row);
+		  }
+		  doNotOptimize(acc);
+	  });
+#endif
+  }
+
+  template<std::size_t... Ways>
+  void vectors(std::size_t n, std::index_sequence<Ways...>) {
+	  std::array<Column, max_ways> columns;
+	  for (auto& column : columns) {
+		  column.resize(n);
+		  std::iota(column.begin(), column.end(), std::int64_t{1});
+	  }
+	  (vectorsWays(columns, std::make_index_sequence<Ways + 1u>{}), ...);
+  }
+
+  void string(std::size_t n) {
+	  Column v (n, 1);
+	  std::string s (n, 'x');
+	  auto const bytes {sizeof(std::int64_t) + sizeof(char)};
+
+	  measure("vector + string zip", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (auto const& [i, c] : itertools::zip(v, s)) acc += i + c;
+		  doNotOptimize(acc);
+	  });
+	  measure("vector + string indexed", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (std::size_t i = 0; i != n; ++i) acc += v[i] + s[i];
+		  doNotOptimize(acc);
+	  });
+  }
+
+  template<typename Container>
+  void nodeBased(std::string const& name, std::size_t n, Container const& container) {
+	  Column v (n, 1);
+	  auto const bytes {sizeof(std::int64_t) + sizeof(typename Container::value_type)};
+
+	  measure("vector + " + name + " zip", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (auto const& [i, value] : itertools::zip(v, container)) {
+			  if constexpr (std::is_integral_v<typename Container::value_type>) acc += i + value;
+			  else acc += i + value.second;
+		  }
+		  doNotOptimize(acc);
+	  });
+	  measure("vector + " + name + " hand-written", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  auto it {container.begin()};
+		  for (std::size_t i = 0; i != n && it != container.end(); ++i, ++it) {
+			  if constexpr (std::is_integral_v<typename Container::value_type>) acc += v[i] + *it;
+			  else acc += v[i] + it->second;
+		  }
+		  doNotOptimize(acc);
+	  });
+  }
+
+  void nodes(std::size_t n) {
+	  std::map<std::int64_t, std::int64_t> m;
+	  std::unordered_map<std::int64_t, std::int64_t> um;
+	  std::list<std::int64_t> l;
+	  for (std::size_t i = 0; i != n; ++i) {
+		  auto const key {static_cast<std::int64_t>(i)};
+		  m.emplace_hint(m.end(), key, key);
+		  um.emplace(key, key);
+		  l.push_back(key);
+	  }
+	  nodeBased("map", n, m);
+	  nodeBased("list", n, l);
+	  nodeBased("unordered_map", n, um);
+  }
+
+  /**
+   * @details
+   * Nodes are allocated in a shuffled order, so the in-order walk\n
+   * jumps over the heap as it does in a long running program.\n
+   * */
+  template<typename Container>
+  void scatteredNodes(std::string const& name, std::size_t n, Container const& container) {
+	  Column v (n, 1);
+	  auto const bytes {sizeof(std::int64_t) + sizeof(typename Container::value_type)};
+	  auto sum = [](auto&& zipped) {
+		  std::int64_t acc {0};
+		  for (auto const& [i, value] : zipped) {
+			  if constexpr (std::is_integral_v<typename Container::value_type>) acc += i + value;
+			  else acc += i + value.second;
+		  }
+		  doNotOptimize(acc);
+	  };
+
+	  measure("vector + scattered " + name + " zip", n, bytes, [&] { sum(itertools::zip(v, container)); });
+  }
+
+  void shuffledNodes(std::size_t n) {
+	  std::vector<std::int64_t> keys (n);
+	  std::iota(keys.begin(), keys.end(), 0);
+	  std::shuffle(keys.begin(), keys.end(), std::mt19937_64{42u});
+
+	  std::map<std::int64_t, std::int64_t> m;
+	  std::list<std::int64_t> l;
+	  for (auto key : keys) {
+		  m.emplace(key, key);
+		  l.push_back(key);
+	  }
+	  l.sort();
+	  scatteredNodes("map", n, m);
+	  scatteredNodes("list", n, l);
+  }
+
+  void hashJoin(std::size_t n) {
+	  std::unordered_map<std::int64_t, std::int64_t> m;
+	  m.reserve(n);
+	  for (std::size_t i = 0; i != n; ++i) m.emplace(static_cast<std::int64_t>(i * 2u), static_cast<std::int64_t>(i));
+	  Column keys (n), weights (n, 1);
+	  std::mt19937_64 random {42u};
+	  for (auto& key : keys) key = static_cast<std::int64_t>(random() % (n * 2u));
+	  auto const bytes {2 * sizeof(std::int64_t)};
+	  auto key = [](auto const& row) { return std::get<0>(row); };
+
+	  measure("hash_join<8> zip probe", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (auto const& [row, value] : itertools::hash_join<8>(itertools::zip(keys, weights), m, key)) acc += std::get<1>(row) * value;
+		  doNotOptimize(acc);
+	  });
+	  measure("hash_join<64> zip probe", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (auto const& [row, value] : itertools::hash_join<64>(itertools::zip(keys, weights), m, key)) acc += std::get<1>(row) * value;
+		  doNotOptimize(acc);
+	  });
+	  measure("find per row hand-written", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (std::size_t i = 0; i != n; ++i) {
+			  auto const found {m.find(keys[i])};
+			  if (found != m.end()) acc += weights[i] * found->second;
+		  }
+		  doNotOptimize(acc);
+	  });
+  }
+
+  void enumerateRows(std::size_t n) {
+	  Column v (n, 1);
+	  std::vector<std::size_t> indices (n);
+	  std::iota(indices.begin(), indices.end(), 0u);
+
+	  measure("vector enumerate", n, sizeof(std::int64_t), [&] {
+		  std::int64_t acc {0};
+		  for (auto const& [i, value] : itertools::enumerate(v)) acc += static_cast<std::int64_t>(i) * value;
+		  doNotOptimize(acc);
+	  });
+	  measure("vector + index vector zip", n, sizeof(std::int64_t) + sizeof(std::size_t), [&] {
+		  std::int64_t acc {0};
+		  for (auto const& [i, value] : itertools::zip(indices, v)) acc += static_cast<std::int64_t>(i) * value;
+		  doNotOptimize(acc);
+	  });
+	  measure("vector indexed", n, sizeof(std::int64_t), [&] {
+		  std::int64_t acc {0};
+		  for (std::size_t i = 0; i != n; ++i) acc += static_cast<std::int64_t>(i) * v[i];
+		  doNotOptimize(acc);
+	  });
+  }
+
+  void vectorBool(std::size_t n) {
+	  std::vector<bool> b (n);
+	  for (std::size_t i = 0; i < n; i += 3) b[i] = true;
+	  Column v (n, 1);
+	  auto const bytes {sizeof(std::int64_t)};
+
+	  measure("vector<bool> + vector zip", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (auto const& [flag, i] : itertools::zip(b, v)) acc += flag ? i : 0;
+		  doNotOptimize(acc);
+	  });
+	  measure("vector<bool> + vector indexed", n, bytes, [&] {
+		  std::int64_t acc {0};
+		  for (std::size_t i = 0; i != n; ++i) acc += b[i] ? v[i] : 0;
+		  doNotOptimize(acc);
+	  });
+  }
+
+  void moveIterators(std::size_t n) {
+	  n = std::min<std::size_t>(n, 1u << 18u);
+	  std::vector<std::string> source, target;
+	  auto const bytes {sizeof(std::string)};
+	  auto prepare = [&] {
+		  source.assign(n, std::string(64u, 'x'));
+		  target.clear();
+		  target.reserve(n);
+	  };
+
+	  measure("move_iterator zip", n, bytes, prepare, [&] {
+		  auto it {itertools::zip(std::make_move_iterator(source.begin()))};
+		  auto const end {itertools::zip(std::make_move_iterator(source.end()))};
+		  for (; it != end; ++it) {
+			  auto&& [s] = *it;
+			  target.emplace_back(std::forward<decltype(s)>(s));
+		  }
+		  doNotOptimize(target.back());
+	  });
+	  measure("move_iterator hand-written", n, bytes, prepare, [&] {
+		  for (auto it = std::make_move_iterator(source.begin()); it != std::make_move_iterator(source.end()); ++it) {
+			  target.emplace_back(*it);
+		  }
+		  doNotOptimize(target.back());
+	  });
+  }
+
+  void sortByKey(std::size_t n) {
+	  Column keys, payload, reference_keys (n);
+	  std::vector<double> weights;
+	  std::uint64_t state {12345u};
+	  for (auto& key : reference_keys) {
+		  state = state * 6364136223846793005u + 1442695040888963407u;
+		  key = static_cast<std::int64_t>(state >> 33u);
+	  }
+	  auto const bytes {2 * sizeof(std::int64_t) + sizeof(double)};
+	  auto prepare = [&] {
+		  keys = reference_keys;
+		  payload = reference_keys;
+		  weights.assign(reference_keys.begin(), reference_keys.end());
+	  };
+
+	  measure("sort_by zip x3", n, bytes, prepare, [&] {
+		  itertools::sort_by<0>(itertools::zip(keys, payload, weights));
+		  doNotOptimize(keys.front());
+	  });
+	  measure("parallel_sort_by zip x3", n, bytes, prepare, [&] {
+		  itertools::parallel_sort_by<0>(itertools::zip(keys, payload, weights));
+		  doNotOptimize(keys.front());
+	  });
+	  measure("index sort + gather x3", n, bytes, prepare, [&] {
+		  std::vector<std::size_t> order (n);
+		  std::iota(order.begin(), order.end(), std::size_t{0u});
+		  std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) { return keys[lhs] < keys[rhs]; });
+		  Column sorted_keys (n), sorted_payload (n);
+		  std::vector<double> sorted_weights (n);
+		  for (std::size_t i = 0; i != n; ++i) {
+			  sorted_keys[i] = keys[order[i]];
+			  sorted_payload[i] = payload[order[i]];
+			  sorted_weights[i] = weights[order[i]];
+		  }
+		  keys.swap(sorted_keys);
+		  payload.swap(sorted_payload);
+		  weights.swap(sorted_weights);
+		  doNotOptimize(keys.front());
+	  });
+  }
+
+}//!namespace
+
+int main(int argc, char** argv) {
+	std::size_t const n {argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1u} << 20u};
+	if (n == 0u) {
+		std::cerr << "usage: " << argv[0] << " [elements], the number of elements should be positive\n";
+		return 1;
+	}
+	std::cout << "elements: " << n << '\n';
+
+	bench::vectors(n, std::index_sequence<0u, 1u, 2u, 3u, 5u, 7u, 11u, 15u>{});
+	bench::string(n);
+	bench::nodes(n);
+	bench::shuffledNodes(n);
+	bench::hashJoin(n);
+	bench::enumerateRows(n);
+	bench::vectorBool(n);
+	bench::moveIterators(n);
+	bench::sortByKey(n);
+
+	return 0;
+}
@@ -11,13 +11,76 @@
 #include <tuple>
 #include <stdexcept>
 #include <string>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#ifdef __cpp_concepts
+#include <span>
+#include <ranges>
+#include <compare>
+#endif
 
 #ifndef ITERTOOLS_H
 #define ITERTOOLS_H
 
 namespace itertools {
 
+  /**
+   * @details
+   * ITERTOOLS_STATS changes the bodies of the zips, so those\n
+   * are in the inline namespace named after it: the translation\n
+   * units, that disagree on the macro, get the different zips\n
+   * (and counters), not two definitions of the same ones.\n
+   * */
+#ifdef ITERTOOLS_STATS
+  inline namespace counted {
+#else
+  inline namespace uncounted {
+#endif
+
+  /**
+   * @details
+   * Counters of the ZipIterator hot path calls, kept per thread.\n
+   * Those are only counted if ITERTOOLS_STATS is defined before\n
+   * the include, otherwise the counting compiles to nothing\n
+   * and the counters stay zero. On the zips, that are not random\n
+   * access, += and -= fall back to single steps, those are counted\n
+   * in the increments and decrements, and in the stepped counter\n
+   * by themselves. A negative n takes no such steps.\n
+   * */
+  struct zip_stats {
+	  std::size_t increments {0u};
+	  std::size_t decrements {0u};
+	  std::size_t advances {0u};
+	  std::size_t stepped {0u};
+	  std::size_t comparisons {0u};
+	  std::size_t dereferences {0u};
+	  std::size_t gets {0u};
+  };
+
+  /**
+   * @details
+   * Counters of the calling thread, these can be reset\n
+   * by assigning an empty zip_stats{}.\n
+   * */
+  inline zip_stats& stats() {
+	  thread_local zip_stats counters;
+	  return counters;
+  }
+
   namespace base::utils {
+#ifdef ITERTOOLS_STATS
+	inline constexpr bool stats_enabled {true};
+#else
+	inline constexpr bool stats_enabled {false};
+#endif
+
+	inline void count([[maybe_unused]] std::size_t zip_stats::* counter, [[maybe_unused]] std::size_t n = 1u) {
+		if constexpr (stats_enabled) stats().*counter += n;
+	}
+
 	template<typename... T1, typename... T2, std::size_t... I>
 	constexpr auto weakComparisonImpl(std::tuple<T1...> const& t1, std::tuple<T2...> const& t2, std::index_sequence<I...>) {
 		bool result {false};
@@ -29,8 +92,274 @@ namespace itertools {
 		static_assert(sizeof...(T1) == sizeof...(T2));
 		return weakComparisonImpl(t1, t2, std::make_index_sequence<sizeof...(T1)>{});
 	}
+
+	/**
+	 * @details
+	 * Index of the iterator that is used as a loop counter\n
+	 * for the sized zips - the first random access one, if any,\n
+	 * as its end can be reached in O(1).\n
+	 * */
+	template<typename... IterCategory>
+	constexpr std::size_t leadIndex() {
+		constexpr bool is_random_access[] {culib::requirements::areAllRandomAccess_v<IterCategory>()...};
+		for (std::size_t i = 0; i != sizeof...(IterCategory); ++i) {
+			if (is_random_access[i]) return i;
+		}
+		return 0u;
+	}
+
+	template<typename Iterator>
+	inline constexpr bool is_random_access_iterator_v {
+		std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category> };
+
+	template<typename Container>
+	std::size_t sizeOf(Container& container) {
+		if constexpr (culib::requirements::is_sized_v<Container&>) {
+			return static_cast<std::size_t>(container.size());
+		}
+		else {
+			return static_cast<std::size_t>(std::distance(container.begin(), container.end()));
+		}
+	}
+
+	template<typename... Containers>
+	std::size_t minSize(Containers&... containers) {
+		std::size_t result {std::numeric_limits<std::size_t>::max()};
+		((result = std::min(result, sizeOf(containers))), ...);
+		return result;
+	}
+
+	template<typename Container, typename... Containers>
+	bool sameSize(Container& first, Containers&... others) {
+		auto const size {sizeOf(first)};
+		return ((sizeOf(others) == size) && ...);
+	}
+
+	/**
+	 * @details
+	 * Iterator to the position n of the container. If the container\n
+	 * is exactly n elements long, then it is just end(), so there\n
+	 * is no walk over the non random access containers.\n
+	 * */
+	template<typename Container>
+	auto advancedBegin(Container& container, std::size_t n) {
+		using Diff = typename std::iterator_traits<decltype(container.begin())>::difference_type;
+		return sizeOf(container) == n ? container.end() : std::next(container.begin(), static_cast<Diff>(n));
+	}
+
+	/**
+	 * @details
+	 * Storage of a zipped container - an rvalue one is owned,\n
+	 * being moved in, while for an lvalue one there is nothing\n
+	 * to store, so the Zipper over lvalues doesn't grow.\n
+	 * The Index keeps the holders of the same type distinct.\n
+	 * */
+	template<std::size_t Index, typename Container>
+	struct ContainerHolder {
+		explicit
+		ContainerHolder(Container&& container) : value (std::move(container))
+		{}
+		Container value;
+	};
+
+	template<std::size_t Index, typename Container>
+	struct ContainerHolder<Index, Container&> {
+		explicit
+		ContainerHolder(Container&)
+		{}
+	};
+
+	template<typename Indices, typename... Containers>
+	struct ContainerStorage;
+
+	template<std::size_t... I, typename... Containers>
+	struct ContainerStorage<std::index_sequence<I...>, Containers...> : ContainerHolder<I, Containers>... {
+		explicit
+		ContainerStorage(Containers&&... containers) : ContainerHolder<I, Containers> (std::forward<Containers>(containers))...
+		{}
+	};
+
+	/**
+	 * @details
+	 * Position of an iterator within the container, end() is\n
+	 * marked as -1, so it is found again without a walk over\n
+	 * the non random access containers.\n
+	 * */
+	template<typename Iterator, typename Container>
+	std::ptrdiff_t offsetOf(Iterator const& it, Container const& container) {
+		decltype(container.begin()) const position (it);
+		return position == container.end() ? -1 : static_cast<std::ptrdiff_t>(std::distance(container.begin(), position));
+	}
+
+	template<typename Iterator, typename Container>
+	Iterator iteratorAt(std::ptrdiff_t offset, Container& container) {
+		using Diff = typename std::iterator_traits<Iterator>::difference_type;
+		return offset < 0 ? Iterator(container.end()) : std::next(Iterator(container.begin()), static_cast<Diff>(offset));
+	}
+
+	/**
+	 * @details
+	 * What std::iter_move provides for an iterator - an rvalue\n
+	 * reference for an lvalue one, any other is kept as it is.\n
+	 * */
+	template<typename Reference>
+	using RvalueReferenceFor = std::conditional_t<
+			std::is_lvalue_reference_v<Reference>,
+			std::remove_reference_t<Reference>&&,
+			Reference>;
+
+	/**
+	 * @details
+	 * State of a ZipIterator, that steps each of the iterators.\n
+	 * */
+	template<typename... Iterators>
+	class SteppedIterators {
+	public:
+		using difference_type = std::common_type_t<typename std::iterator_traits<Iterators>::difference_type...>;
+
+		SteppedIterators() = default;
+		explicit
+		SteppedIterators(Iterators&&... iters) : iterators (std::forward<Iterators>(iters)...)
+		{}
+
+		template<std::size_t Index>
+		auto const& at() const { return std::get<Index>(iterators); }
+
+		void next() { std::apply([](Iterators&... iter){ ((++iter), ...); }, iterators); }
+		void prev() { std::apply([](Iterators&... iter){ ((--iter), ...); }, iterators); }
+		void advance(difference_type n) { std::apply([n](Iterators&... iter){ ((iter += n), ...); }, iterators); }
+
+		bool equals(SteppedIterators const& other) const {
+			return weakComparison(iterators, other.iterators);
+		}
+
+	private:
+		std::tuple<Iterators...> iterators;
+	};
+
+	/**
+	 * @details
+	 * State of a ZipIterator over the contiguous iterators only -\n
+	 * the bases are not changed, while the only index is shared,\n
+	 * so a step is a single addition, and the loop keeps one\n
+	 * counter instead of N iterators.\n
+	 * */
+	template<typename... Iterators>
+	class IndexedIterators {
+	public:
+		using difference_type = std::common_type_t<typename std::iterator_traits<Iterators>::difference_type...>;
+
+		IndexedIterators() = default;
+		explicit
+		IndexedIterators(Iterators&&... iters) : bases (std::forward<Iterators>(iters)...)
+		{}
+
+		template<std::size_t Index>
+		auto at() const { return std::get<Index>(bases) + index; }
+
+		void next() { ++index; }
+		void prev() { --index; }
+		void advance(difference_type n) { index += n; }
+
+		/**
+		 * @details
+		 * The iterators may come from different bases, as zip(first...)\n
+		 * and zip(last...) do, so the positions are compared, and the same\n
+		 * weak comparison is kept - any pair of equal ones is enough.\n
+		 * */
+		bool equals(IndexedIterators const& other) const {
+			return equalsImpl(other, std::index_sequence_for<Iterators...>{});
+		}
+
+	private:
+		std::tuple<Iterators...> bases;
+		difference_type index {0};
+
+		template<std::size_t... I>
+		bool equalsImpl(IndexedIterators const& other, std::index_sequence<I...>) const {
+			return ((at<I>() == other.template at<I>()) || ...);
+		}
+	};
   }
 
+  /**
+   * @details
+   * Reference type of ZipIterator - a tuple of the references,\n
+   * that is assignable being const, as the proxy references are,\n
+   * and has the common reference with the tuple of values, so\n
+   * std::ranges algorithms, like sort, take the zipped ranges.\n
+   * */
+  template<typename... Refs>
+  class zip_reference : public std::tuple<Refs...> {
+  public:
+	  using base_type = std::tuple<Refs...>;
+	  using base_type::base_type;
+
+	  zip_reference(zip_reference const&) = default;
+	  zip_reference(zip_reference &&) = default;
+
+	  /**
+	   * @details
+	   * Assignment writes through the references, as a proxy does.\n
+	   * */
+	  zip_reference const& operator = (zip_reference const& other) const {
+		  assign(static_cast<base_type const&>(other), std::index_sequence_for<Refs...>{});
+		  return *this;
+	  }
+
+	  zip_reference const& operator = (zip_reference && other) const {
+		  assign(static_cast<base_type &&>(other), std::index_sequence_for<Refs...>{});
+		  return *this;
+	  }
+
+	  /**
+	   * @details
+	   * Binding the references to the elements of a tuple of values.\n
+	   * */
+	  template<typename... Us, std::enable_if_t<(std::is_constructible_v<Refs, Us&> && ...), bool> = true>
+	  zip_reference(std::tuple<Us...>& values) : zip_reference(values, std::index_sequence_for<Refs...>{})
+	  {}
+
+	  template<typename... Us>
+	  zip_reference const& operator = (std::tuple<Us...> const& values) const {
+		  static_assert(sizeof...(Us) == sizeof...(Refs));
+		  assign(values, std::index_sequence_for<Refs...>{});
+		  return *this;
+	  }
+
+	  template<typename... Us>
+	  zip_reference const& operator = (std::tuple<Us...>&& values) const {
+		  static_assert(sizeof...(Us) == sizeof...(Refs));
+		  assign(std::move(values), std::index_sequence_for<Refs...>{});
+		  return *this;
+	  }
+
+	  /**
+	   * @details
+	   * Swapping the referred elements, so the algorithms, that\n
+	   * swap *it's, work on the zipped ranges.\n
+	   * */
+	  friend void swap(zip_reference const& lhs, zip_reference const& rhs) {
+		  lhs.swapWith(rhs, std::index_sequence_for<Refs...>{});
+	  }
+
+  private:
+	  template<std::size_t... I>
+	  void swapWith(zip_reference const& other, std::index_sequence<I...>) const {
+		  using std::swap;
+		  (swap(std::get<I>(static_cast<base_type const&>(*this)), std::get<I>(static_cast<base_type const&>(other))), ...);
+	  }
+
+	  template<typename... Us, std::size_t... I>
+	  zip_reference(std::tuple<Us...>& values, std::index_sequence<I...>) : base_type(std::get<I>(values)...)
+	  {}
+
+	  template<typename Values, std::size_t... I>
+	  void assign(Values&& values, std::index_sequence<I...>) const {
+		  ((std::get<I>(static_cast<base_type const&>(*this)) = std::get<I>(std::forward<Values>(values))), ...);
+	  }
+  };
+
 #ifndef __cpp_concepts
   template<typename... Iterators>
 #else
@@ -40,13 +369,13 @@ namespace itertools {
   private:
 
 	  template<typename SomeIter>
-	  using ValueTypeFor = typename SomeIter::value_type;
+	  using ValueTypeFor = typename std::iterator_traits<SomeIter>::value_type;
 
 	  template<typename SomeIter>
-	  using ReferenceTypeFor = typename SomeIter::reference;
+	  using ReferenceTypeFor = typename std::iterator_traits<SomeIter>::reference;
 
 	  template<typename SomeIter>
-	  using DifferenceTypeFor = typename SomeIter::difference_type;
+	  using DifferenceTypeFor = typename std::iterator_traits<SomeIter>::difference_type;
 
 	  template<typename SomeIter>
 	  using IteratorCategoryFor = typename std::iterator_traits<SomeIter>::iterator_category;
@@ -65,15 +394,29 @@ namespace itertools {
 		  Reference *operator->() { return &R; } // non const
 	  };
 
+	  using State = std::conditional_t<
+			  culib::requirements::areAllContiguousIterators_v<Iterators...>(),
+			  base::utils::IndexedIterators<Iterators...>,
+			  base::utils::SteppedIterators<Iterators...>>;
+
   public:
 	  using iterator_type = ZipIterator;
 	  using iterator_category = std::common_type_t<IteratorCategoryFor<Iterators>...>;
+	  using iterator_concept = iterator_category;
 	  using value_type = typename std::tuple<ValueTypeFor<Iterators>...>;
-	  using reference = typename std::tuple<ReferenceTypeFor<Iterators>...>;
+	  using reference = zip_reference<ReferenceTypeFor<Iterators>...>;
+	  using rvalue_reference = zip_reference<base::utils::RvalueReferenceFor<ReferenceTypeFor<Iterators>>...>;
 	  using pointer = arrowProxy<reference>;
 	  using difference_type = std::common_type_t<DifferenceTypeFor<Iterators>...>;
 
-	  ZipIterator() = delete;
+	  /**
+	   * @details
+	   * All of the iterators are moved in a lockstep, so the distance\n
+	   * and the ordering are taken from the leading one only.\n
+	   * */
+	  static constexpr std::size_t lead { base::utils::leadIndex<IteratorCategoryFor<Iterators>...>() };
+
+	  ZipIterator() = default;
 	  ZipIterator(ZipIterator const&) = default;
 	  ZipIterator(ZipIterator &&) = default;
 	  ZipIterator& operator = (ZipIterator const&) = default;
@@ -83,10 +426,11 @@ namespace itertools {
 	  template<culib::requirements::AreAllIterators<Iterators...> = true>
 #endif
 	  explicit
-	  ZipIterator(Iterators&&... iters) :iterators (std::make_tuple(std::forward<Iterators>(iters)...))
+	  ZipIterator(Iterators&&... iters) :state (std::forward<Iterators>(iters)...)
 	  {}
 	  ZipIterator& operator++() {
-		  std::apply([](Iterators&... iter){ ((++iter), ...); }, iterators);
+		  base::utils::count(&zip_stats::increments);
+		  state.next();
 		  return *this;
 	  }
 	  ZipIterator operator++(int) {
@@ -94,12 +438,14 @@ namespace itertools {
 		  operator++();
 		  return tmp;
 	  }
-	  ZipIterator& operator+=(int n) {
+	  ZipIterator& operator+=(difference_type n) {
+		  base::utils::count(&zip_stats::advances);
 		  if constexpr (culib::requirements::areAllRandomAccess_v<IteratorCategoryFor<Iterators>...>()) {
-			  std::apply([n](Iterators&... iter){ ((iter += n), ...); }, iterators);
+			  state.advance(n);
 		  }
 		  else  {
-			  for (int i = 0; i<n; ++i) ++(*this);
+			  base::utils::count(&zip_stats::stepped, static_cast<std::size_t>(std::max<difference_type>(n, 0)));
+			  for (difference_type i = 0; i<n; ++i) ++(*this);
 		  }
 		  return *this;
 	  }
@@ -114,7 +460,8 @@ namespace itertools {
 	  requires culib::requirements::BiDirectionalOrRandomAccess<iterator_category>
 #endif
 	  {
-		  std::apply([](Iterators&... iter){ ((--iter), ...); }, iterators);
+		  base::utils::count(&zip_stats::decrements);
+		  state.prev();
 		  return *this;
 	  }
 
@@ -139,25 +486,42 @@ namespace itertools {
 			  typename DummyArg = iterator_category,
 			  culib::requirements::BiDirectionalOrRandomAccess<DummyArg> = true>
 #endif
-	  ZipIterator& operator-=(int n)
+	  ZipIterator& operator-=(difference_type n)
 #ifdef __cpp_concepts
 	  requires culib::requirements::BiDirectionalOrRandomAccess<iterator_category>
 #endif
 	  {
+		  base::utils::count(&zip_stats::advances);
 		  if constexpr (culib::requirements::areAllRandomAccess_v<IteratorCategoryFor<Iterators>...>()) {
-			  std::apply([n](Iterators&... iter){ ((iter -= n), ...); }, iterators);
+			  state.advance(-n);
 		  }
 		  else {
-			  for (int i = 0; i<n; ++i) --(*this);
+			  base::utils::count(&zip_stats::stepped, static_cast<std::size_t>(std::max<difference_type>(n, 0)));
+			  for (difference_type i = 0; i<n; ++i) --(*this);
 		  }
 		  return *this;
 	  }
 
 	  bool equals(ZipIterator const& other) const {
-		  return base::utils::weakComparison(this->iterators, other.iterators);
+		  base::utils::count(&zip_stats::comparisons);
+		  return state.equals(other.state);
 	  }
-	  reference operator*() { return makeRefs(); }
 	  reference operator*() const { return makeRefs(); }
+
+#ifndef __cpp_concepts
+	  template<
+			  typename DummyArg = iterator_category,
+			  std::enable_if_t<culib::requirements::areAllRandomAccess_v<DummyArg>(), bool> = true>
+#endif
+	  reference operator[](difference_type n) const
+#ifdef __cpp_concepts
+	  requires (culib::requirements::areAllRandomAccess_v<iterator_category>())
+#endif
+	  {
+		  ZipIterator tmp(*this);
+		  tmp += n;
+		  return *tmp;
+	  }
 	  //it is supposed to survive just a drill-down
 	  pointer operator->() { return pointer{makeRefs()}; }
 
@@ -171,135 +535,1040 @@ namespace itertools {
 	   *
 	   * */
 	  template<std::size_t Index>
-	  decltype(auto) get() &  { return std::get<Index>(iterators).operator*(); }
+	  decltype(auto) get() &  {
+		  base::utils::count(&zip_stats::gets);
+		  return *state.template at<Index>();
+	  }
+	  template<std::size_t Index>
+	  decltype(auto) get() && {
+		  base::utils::count(&zip_stats::gets);
+		  return take<Index>();
+	  }
 	  template<std::size_t Index>
-	  decltype(auto) get() && { return std::get<Index>(iterators).operator*(); }
+	  decltype(auto) get() const &  {
+		  base::utils::count(&zip_stats::gets);
+		  return *state.template at<Index>();
+	  }
 	  template<std::size_t Index>
-	  decltype(auto) get() const &  { return std::get<Index>(iterators).operator*(); }
+	  decltype(auto) get() const && {
+		  base::utils::count(&zip_stats::gets);
+		  return take<Index>();
+	  }
+
+	  /**
+	   * @details
+	   * Underlying iterator at the Index position.\n
+	   * */
 	  template<std::size_t Index>
-	  decltype(auto) get() const && { return std::get<Index>(iterators).operator*(); }
+	  decltype(auto) base() const { return state.template at<Index>(); }
+
+	  /**
+	   * @details
+	   * Customization points, found by ADL - std::ranges::iter_move\n
+	   * and std::ranges::iter_swap, or the algorithms, that swap\n
+	   * the proxy references of zipped ranges.\n
+	   * */
+	  friend rvalue_reference iter_move(ZipIterator const& it) {
+		  return it.moveRefs(std::make_index_sequence<sizeof...(Iterators)>{});
+	  }
+
+	  friend void iter_swap(ZipIterator const& lhs, ZipIterator const& rhs) {
+		  lhs.swapWith(rhs, std::make_index_sequence<sizeof...(Iterators)>{});
+	  }
 
   private:
 
-	  std::tuple<Iterators...> iterators;
+	  State state;
 
 	  template <std::size_t... I>
-	  auto makeRefsImpl (std::index_sequence<I...>) {
-		  return reference ({ std::get<I>(iterators).operator*()... });
+	  rvalue_reference moveRefs (std::index_sequence<I...>) const {
+		  return rvalue_reference (static_cast<base::utils::RvalueReferenceFor<ReferenceTypeFor<Iterators>>>(*state.template at<I>())...);
 	  }
-	  auto makeRefs () {
+
+	  template <std::size_t... I>
+	  void swapWith (ZipIterator const& other, std::index_sequence<I...>) const {
+#ifdef __cpp_concepts
+		  (std::ranges::iter_swap(state.template at<I>(), other.state.template at<I>()), ...);
+#else
+		  (std::iter_swap(state.template at<I>(), other.state.template at<I>()), ...);
+#endif
+	  }
+
+	  /**
+	   * @details
+	   * The references are forwarded as they are, so the rvalue\n
+	   * references of the move iterators stay rvalue references\n
+	   * and nothing is copied while the tuple is built.\n
+	   * */
+	  template <std::size_t... I>
+	  reference makeRefsImpl (std::index_sequence<I...>) const {
+		  return reference (*state.template at<I>()...);
+	  }
+	  reference makeRefs () const {
+		  base::utils::count(&zip_stats::dereferences);
 		  return makeRefsImpl (std::make_index_sequence<sizeof...(Iterators)>{});
 	  }
+
+	  /**
+	   * @details
+	   * Decomposing an expiring ZipIterator, the elements\n
+	   * provided by rvalue references (move iterators) are moved\n
+	   * into the bindings, so those own the elements and no copy\n
+	   * is made. Other references are provided as they are.\n
+	   * */
+	  template<std::size_t Index>
+	  decltype(auto) take() const {
+		  using Reference = ReferenceTypeFor<std::tuple_element_t<Index, std::tuple<Iterators...>>>;
+		  if constexpr (std::is_rvalue_reference_v<Reference>) {
+			  return std::remove_cv_t<std::remove_reference_t<Reference>> (*state.template at<Index>());
+		  }
+		  else {
+			  return *state.template at<Index>();
+		  }
+	  }
   };
 
   template<typename... Iterators>
-  static inline bool operator==(ZipIterator<Iterators...> lhs, ZipIterator<Iterators...> rhs) {
+  static inline bool operator==(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs) {
 	  return lhs.equals(rhs);
   }
 
   template<typename... Iterators>
-  static inline bool operator!=(ZipIterator<Iterators...> lhs, ZipIterator<Iterators...> rhs) {
+  static inline bool operator!=(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs) {
 	  return !lhs.equals(rhs);
   }
 
   template<typename... Iterators>
-  static inline ZipIterator<Iterators...> operator+(ZipIterator<Iterators...> it, int n) {
+  static inline ZipIterator<Iterators...> operator+(ZipIterator<Iterators...> it, typename ZipIterator<Iterators...>::difference_type n) {
+	  it += n;
+	  return it;
+  }
+
+  template<typename... Iterators>
+  static inline ZipIterator<Iterators...> operator+(typename ZipIterator<Iterators...>::difference_type n, ZipIterator<Iterators...> it) {
 	  it += n;
 	  return it;
   }
 
   template<typename... Iterators>
-  static inline ZipIterator<Iterators...> operator-(ZipIterator<Iterators...> it, int n) {
+  static inline ZipIterator<Iterators...> operator-(ZipIterator<Iterators...> it, typename ZipIterator<Iterators...>::difference_type n) {
 	  it -= n;
 	  return it;
   }
 
-#ifndef __cpp_concepts
-  template<typename... Containers>
+  /**
+   * @details
+   * Distance and ordering are available when the leading\n
+   * iterator provides those, so it is O(1).\n
+   * */
+  template<typename... Iterators, std::size_t Lead = ZipIterator<Iterators...>::lead>
+  static inline auto operator-(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs)
+  -> decltype(static_cast<typename ZipIterator<Iterators...>::difference_type>(lhs.template base<Lead>() - rhs.template base<Lead>())) {
+	  return static_cast<typename ZipIterator<Iterators...>::difference_type>(lhs.template base<Lead>() - rhs.template base<Lead>());
+  }
+
+#ifdef __cpp_concepts
+  template<typename... Iterators, std::size_t Lead = ZipIterator<Iterators...>::lead>
+  static inline auto operator<=>(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs)
+  -> decltype(lhs.template base<Lead>() <=> rhs.template base<Lead>()) {
+	  return lhs.template base<Lead>() <=> rhs.template base<Lead>();
+  }
 #else
-  template<culib::requirements::AreAllContainers... Containers>
+  template<typename... Iterators, std::size_t Lead = ZipIterator<Iterators...>::lead>
+  static inline auto operator<(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs)
+  -> decltype(bool(lhs.template base<Lead>() < rhs.template base<Lead>())) {
+	  return lhs.template base<Lead>() < rhs.template base<Lead>();
+  }
+
+  template<typename... Iterators, std::size_t Lead = ZipIterator<Iterators...>::lead>
+  static inline auto operator>(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs)
+  -> decltype(bool(lhs.template base<Lead>() < rhs.template base<Lead>())) {
+	  return rhs < lhs;
+  }
+
+  template<typename... Iterators, std::size_t Lead = ZipIterator<Iterators...>::lead>
+  static inline auto operator<=(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs)
+  -> decltype(bool(lhs.template base<Lead>() < rhs.template base<Lead>())) {
+	  return !(rhs < lhs);
+  }
+
+  template<typename... Iterators, std::size_t Lead = ZipIterator<Iterators...>::lead>
+  static inline auto operator>=(ZipIterator<Iterators...> const& lhs, ZipIterator<Iterators...> const& rhs)
+  -> decltype(bool(lhs.template base<Lead>() < rhs.template base<Lead>())) {
+	  return !(lhs < rhs);
+  }
 #endif
-  class Zipper {
-  private:
 
-	  /**
-	   * @details
-	   * This seemingly innocent iterator type selection serves\n
-	   * as a guard - no Type without an iterator can pass this.\n
-	   * \n
-	   * */
-	  template<typename Input>
-	  using IteratorTypeSelect = std::conditional_t<
-			  std::is_const_v<std::remove_reference_t<Input>>,
-			  typename std::remove_reference_t<Input>::const_iterator,
-			  typename std::remove_reference_t<Input>::iterator>;
+  /**
+   * @details
+   * End of a zipped range, that keeps only the iterators\n
+   * to be checked - for a sized range that is the only one,\n
+   * the leading iterator, that serves as a loop counter.\n
+   * For the unsized range all of the ends are tracked.\n
+   * It is compared to ZipIterator by a heterogeneous operator==,\n
+   * both taken by a const reference.\n
+   * */
+  template<typename Zip, std::size_t... Tracked>
+  class zip_sentinel {
+  private:
+	  template<std::size_t Index>
+	  using IteratorTypeFor = std::decay_t<decltype(std::declval<Zip const&>().template base<Index>())>;
 
   public:
-	  using zip_type = ZipIterator<IteratorTypeSelect<Containers>...>;
-
-	  Zipper() = delete;
+	  zip_sentinel() = default;
 
-#ifndef __cpp_concepts
-	  template<culib::requirements::AreAllContainers<Containers...> = true>
-#endif
 	  explicit
-	  Zipper(Containers&&... inputs)
-			  : begin_ (std::forward<Containers>(inputs).begin()...)
-			  , end_ (std::forward<Containers>(inputs).end()...)
+	  zip_sentinel(IteratorTypeFor<Tracked>... lasts) : lasts (std::move(lasts)...)
 	  {}
 
-	  zip_type begin() const { return begin_ ; }
-	  zip_type& begin() { return begin_ ; }
-	  zip_type end() const { return end_; }
-	  zip_type& end() { return end_; }
+	  bool equals(Zip const& it) const {
+		  base::utils::count(&zip_stats::comparisons);
+		  return equalsImpl(it, std::make_index_sequence<sizeof...(Tracked)>{});
+	  }
+
+	  /**
+	   * @details
+	   * End of the underlying container Index, which should\n
+	   * be one of the tracked ones.\n
+	   * */
+	  template<std::size_t Index>
+	  auto const& last() const { return std::get<positionOf<Index>()>(lasts); }
+
   private:
-	  zip_type begin_, end_;
+	  std::tuple<IteratorTypeFor<Tracked>...> lasts;
+
+	  template<std::size_t Index>
+	  static constexpr std::size_t positionOf() {
+		  constexpr std::size_t tracked[] {Tracked...};
+		  std::size_t i {0u};
+		  while (tracked[i] != Index) ++i;
+		  return i;
+	  }
+
+	  template<std::size_t... I>
+	  bool equalsImpl(Zip const& it, std::index_sequence<I...>) const {
+		  return ((it.template base<Tracked>() == std::get<I>(lasts)) || ...);
+	  }
   };
 
+  namespace base::utils {
+	template<typename Zip, typename Indices>
+	struct FullSentinel;
+
+	template<typename Zip, std::size_t... I>
+	struct FullSentinel<Zip, std::index_sequence<I...>> {
+		using type = zip_sentinel<Zip, I...>;
+	};
+  }//!namespace
+
+  template<typename Zip, std::size_t... Tracked>
+  static inline bool operator==(Zip const& it, zip_sentinel<Zip, Tracked...> const& sentinel) {
+	  return sentinel.equals(it);
+  }
+
+  template<typename Zip, std::size_t... Tracked>
+  static inline bool operator==(zip_sentinel<Zip, Tracked...> const& sentinel, Zip const& it) {
+	  return sentinel.equals(it);
+  }
+
+  template<typename Zip, std::size_t... Tracked>
+  static inline bool operator!=(Zip const& it, zip_sentinel<Zip, Tracked...> const& sentinel) {
+	  return !sentinel.equals(it);
+  }
+
+  template<typename Zip, std::size_t... Tracked>
+  static inline bool operator!=(zip_sentinel<Zip, Tracked...> const& sentinel, Zip const& it) {
+	  return !sentinel.equals(it);
+  }
+
   /**
    * @details
-   * Considering all the options, there should be at least a pair\n
-   * of iterators to provide a valid range.\n\n
-   * So all of the inputs should satisfy the requirements to have\n
-   * both .begin() and end(), therefore each argument is, or  \n
-   * should be, a container.\n
-   *
+   * A sentinel, that tracks the only random access iterator,\n
+   * is O(1) away from the zipped iterator.\n
    * */
+  template<typename Zip, std::size_t Lead>
+  static inline auto operator-(zip_sentinel<Zip, Lead> const& sentinel, Zip const& it)
+  -> decltype(static_cast<typename Zip::difference_type>(sentinel.template last<Lead>() - it.template base<Lead>())) {
+	  return static_cast<typename Zip::difference_type>(sentinel.template last<Lead>() - it.template base<Lead>());
+  }
 
-#ifndef __cpp_concepts
-  template<typename... Containers, culib::requirements::AreAllContainers<Containers...> = true>
-#else
-  template<culib::requirements::AreAllContainers... Containers>
-#endif
-  auto zip(Containers&&... containers) {
-	  return Zipper<Containers...> (std::forward<Containers>(containers)...);
+  template<typename Zip, std::size_t Lead>
+  static inline auto operator-(Zip const& it, zip_sentinel<Zip, Lead> const& sentinel)
+  -> decltype(static_cast<typename Zip::difference_type>(it.template base<Lead>() - sentinel.template last<Lead>())) {
+	  return static_cast<typename Zip::difference_type>(it.template base<Lead>() - sentinel.template last<Lead>());
   }
+
   /**
    * @details
-   * Just a ZipIterator will be provided from this func.\n
+   * Random access iterator over the numbers, that are computed\n
+   * instead of being read from the memory - a step is just\n
+   * an increment of the number it holds.\n
    * */
+  template<typename T = std::size_t>
+  class counting_iterator {
+  public:
+	  static_assert(std::is_integral_v<T>, "Only integral values can be counted");
 
-#ifndef __cpp_concepts
-  template<typename... Iterators, culib::requirements::AreAllIterators<Iterators...> = true>
-#else
-  template<culib::requirements::AreAllIterators... Iterators>
-#endif
-  auto zip(Iterators&&... iterators) {
-	  return ZipIterator<Iterators...> (std::forward<Iterators>(iterators)...);
-  }
-
-}//!namespace
+	  using iterator_category = std::random_access_iterator_tag;
+	  using iterator_concept = iterator_category;
+	  using value_type = T;
+	  using difference_type = std::ptrdiff_t;
+	  using reference = T;
+	  using pointer = void;
 
+	  counting_iterator() = default;
+	  explicit
+	  counting_iterator(T value) : value (value)
+	  {}
 
-/**
- * @details
- * Extending namespace std:: for user-defined structural binding.\n
- *
- * */
+	  reference operator*() const { return value; }
+	  reference operator[](difference_type n) const { return static_cast<T>(value + n); }
 
-namespace std {
-  template<typename... Iterators>
-  struct tuple_size<itertools::ZipIterator<Iterators...>> :
+	  counting_iterator& operator++() {
+		  ++value;
+		  return *this;
+	  }
+	  counting_iterator operator++(int) {
+		  counting_iterator tmp(*this);
+		  ++value;
+		  return tmp;
+	  }
+	  counting_iterator& operator--() {
+		  --value;
+		  return *this;
+	  }
+	  counting_iterator operator--(int) {
+		  counting_iterator tmp(*this);
+		  --value;
+		  return tmp;
+	  }
+	  counting_iterator& operator+=(difference_type n) {
+		  value = static_cast<T>(value + n);
+		  return *this;
+	  }
+	  counting_iterator& operator-=(difference_type n) {
+		  value = static_cast<T>(value - n);
+		  return *this;
+	  }
+
+  private:
+	  T value {0};
+  };
+
+  template<typename T>
+  static inline counting_iterator<T> operator+(counting_iterator<T> it, std::ptrdiff_t n) {
+	  return it += n;
+  }
+
+  template<typename T>
+  static inline counting_iterator<T> operator+(std::ptrdiff_t n, counting_iterator<T> it) {
+	  return it += n;
+  }
+
+  template<typename T>
+  static inline counting_iterator<T> operator-(counting_iterator<T> it, std::ptrdiff_t n) {
+	  return it -= n;
+  }
+
+  template<typename T>
+  static inline std::ptrdiff_t operator-(counting_iterator<T> const& lhs, counting_iterator<T> const& rhs) {
+	  return static_cast<std::ptrdiff_t>(*lhs) - static_cast<std::ptrdiff_t>(*rhs);
+  }
+
+  template<typename T>
+  static inline bool operator==(counting_iterator<T> const& lhs, counting_iterator<T> const& rhs) { return *lhs == *rhs; }
+
+  template<typename T>
+  static inline bool operator!=(counting_iterator<T> const& lhs, counting_iterator<T> const& rhs) { return *lhs != *rhs; }
+
+  template<typename T>
+  static inline bool operator<(counting_iterator<T> const& lhs, counting_iterator<T> const& rhs) { return *lhs < *rhs; }
+
+  template<typename T>
+  static inline bool operator>(counting_iterator<T> const& lhs, counting_iterator<T> const& rhs) { return *lhs > *rhs; }
+
+  template<typename T>
+  static inline bool operator<=(counting_iterator<T> const& lhs, counting_iterator<T> const& rhs) { return *lhs <= *rhs; }
+
+  template<typename T>
+  static inline bool operator>=(counting_iterator<T> const& lhs, counting_iterator<T> const& rhs) { return *lhs >= *rhs; }
+
+  /**
+   * @details
+   * Numbers in [first, last), as a container to be zipped.\n
+   * By default it is unbounded, so a zip is as long as\n
+   * the other containers are.\n
+   * */
+  template<typename T = std::size_t>
+  class counting_range {
+  public:
+	  using iterator = counting_iterator<T>;
+	  using const_iterator = iterator;
+	  using value_type = T;
+	  using size_type = std::size_t;
+
+	  counting_range() = default;
+	  counting_range(T first, T last) : first (first), last (last)
+	  {}
+
+	  iterator begin() const { return iterator (first); }
+	  iterator end() const { return iterator (last); }
+	  size_type size() const { return static_cast<size_type>(last - first); }
+
+  private:
+	  T first {0};
+	  T last {std::numeric_limits<T>::max()};
+  };
+
+  /**
+   * @details
+   * Random access iterator over every step-th row of a random\n
+   * access Zip. It keeps the first row and the number of the\n
+   * current one, so it never points past the end of the zip.\n
+   * */
+  template<typename Zip>
+  class stride_iterator {
+  public:
+	  using iterator_category = std::random_access_iterator_tag;
+	  using iterator_concept = iterator_category;
+	  using value_type = typename Zip::value_type;
+	  using difference_type = typename Zip::difference_type;
+	  using reference = typename Zip::reference;
+	  using pointer = void;
+
+	  stride_iterator() = default;
+	  stride_iterator(Zip first, difference_type step, difference_type row)
+			  : first (std::move(first))
+			  , step (step)
+			  , row (row)
+	  {}
+
+	  reference operator*() const { return first[row * step]; }
+	  reference operator[](difference_type n) const { return first[(row + n) * step]; }
+
+	  stride_iterator& operator++() {
+		  ++row;
+		  return *this;
+	  }
+	  stride_iterator operator++(int) {
+		  stride_iterator tmp(*this);
+		  ++row;
+		  return tmp;
+	  }
+	  stride_iterator& operator--() {
+		  --row;
+		  return *this;
+	  }
+	  stride_iterator operator--(int) {
+		  stride_iterator tmp(*this);
+		  --row;
+		  return tmp;
+	  }
+	  stride_iterator& operator+=(difference_type n) {
+		  row += n;
+		  return *this;
+	  }
+	  stride_iterator& operator-=(difference_type n) {
+		  row -= n;
+		  return *this;
+	  }
+
+	  difference_type index() const { return row; }
+
+  private:
+	  Zip first;
+	  difference_type step {1};
+	  difference_type row {0};
+  };
+
+  template<typename Zip>
+  static inline stride_iterator<Zip> operator+(stride_iterator<Zip> it, typename Zip::difference_type n) {
+	  return it += n;
+  }
+
+  template<typename Zip>
+  static inline stride_iterator<Zip> operator+(typename Zip::difference_type n, stride_iterator<Zip> it) {
+	  return it += n;
+  }
+
+  template<typename Zip>
+  static inline stride_iterator<Zip> operator-(stride_iterator<Zip> it, typename Zip::difference_type n) {
+	  return it -= n;
+  }
+
+  template<typename Zip>
+  static inline auto operator-(stride_iterator<Zip> const& lhs, stride_iterator<Zip> const& rhs) {
+	  return lhs.index() - rhs.index();
+  }
+
+  template<typename Zip>
+  static inline bool operator==(stride_iterator<Zip> const& lhs, stride_iterator<Zip> const& rhs) { return lhs.index() == rhs.index(); }
+
+  template<typename Zip>
+  static inline bool operator!=(stride_iterator<Zip> const& lhs, stride_iterator<Zip> const& rhs) { return lhs.index() != rhs.index(); }
+
+  template<typename Zip>
+  static inline bool operator<(stride_iterator<Zip> const& lhs, stride_iterator<Zip> const& rhs) { return lhs.index() < rhs.index(); }
+
+  template<typename Zip>
+  static inline bool operator>(stride_iterator<Zip> const& lhs, stride_iterator<Zip> const& rhs) { return lhs.index() > rhs.index(); }
+
+  template<typename Zip>
+  static inline bool operator<=(stride_iterator<Zip> const& lhs, stride_iterator<Zip> const& rhs) { return lhs.index() <= rhs.index(); }
+
+  template<typename Zip>
+  static inline bool operator>=(stride_iterator<Zip> const& lhs, stride_iterator<Zip> const& rhs) { return lhs.index() >= rhs.index(); }
+
+  /**
+   * @details
+   * Just a pair of an iterator and a sentinel, to be used\n
+   * in a range-based for loop.\n
+   * */
+  template<typename Iterator, typename Sentinel = Iterator>
+  class iterator_range {
+  public:
+	  iterator_range(Iterator first, Sentinel last)
+			  : first (std::move(first))
+			  , last (std::move(last))
+	  {}
+	  Iterator begin() const { return first; }
+	  Sentinel end() const { return last; }
+
+	  /**
+	   * @details
+	   * Only if the distance between the ends is O(1).\n
+	   * */
+	  template<typename It = Iterator>
+	  auto size() const -> decltype(static_cast<std::size_t>(std::declval<Sentinel const&>() - std::declval<It const&>())) {
+		  return static_cast<std::size_t>(last - first);
+	  }
+  private:
+	  Iterator first;
+	  Sentinel last;
+  };
+
+#ifdef __cpp_concepts
+  template<typename T, std::size_t Width>
+  using span_block = std::span<T, Width>;
+#else
+  /**
+   * @details
+   * Fixed width view over a contiguous block, a replacement\n
+   * for std::span<T, Width> in C++17.\n
+   * */
+  template<typename T, std::size_t Width>
+  class span_block {
+  public:
+	  using element_type = T;
+	  using value_type = std::remove_cv_t<T>;
+	  using size_type = std::size_t;
+	  using pointer = T*;
+	  using reference = T&;
+	  using iterator = T*;
+
+	  span_block(T* first, std::size_t) : first (first)
+	  {}
+	  T* data() const { return first; }
+	  T* begin() const { return first; }
+	  T* end() const { return first + Width; }
+	  T& operator[](std::size_t index) const { return first[index]; }
+	  static constexpr std::size_t size() { return Width; }
+  private:
+	  T* first;
+  };
+#endif
+
+  /**
+   * @details
+   * Iterator over the blocks of Width elements of the contiguous\n
+   * zipped containers. All of the columns share one offset, so\n
+   * a step is a single addition.\n
+   * */
+  template<std::size_t Width, typename... Ts>
+  class ChunkIterator {
+  public:
+	  using iterator_type = ChunkIterator;
+	  using iterator_category = std::forward_iterator_tag;
+	  using value_type = std::tuple<span_block<Ts, Width>...>;
+	  using reference = value_type;
+	  using pointer = void;
+	  using difference_type = std::ptrdiff_t;
+
+	  ChunkIterator(std::tuple<Ts*...> bases, std::size_t offset)
+			  : bases (bases)
+			  , offset (offset)
+	  {}
+
+	  reference operator*() const {
+		  return std::apply([this](Ts*... base) { return reference (span_block<Ts, Width>(base + offset, Width)...); }, bases);
+	  }
+	  ChunkIterator& operator++() {
+		  offset += Width;
+		  return *this;
+	  }
+	  ChunkIterator operator++(int) {
+		  ChunkIterator tmp(*this);
+		  operator++();
+		  return tmp;
+	  }
+	  bool equals(ChunkIterator const& other) const { return offset == other.offset; }
+
+  private:
+	  std::tuple<Ts*...> bases;
+	  std::size_t offset;
+  };
+
+  template<std::size_t Width, typename... Ts>
+  static inline bool operator==(ChunkIterator<Width, Ts...> const& lhs, ChunkIterator<Width, Ts...> const& rhs) {
+	  return lhs.equals(rhs);
+  }
+
+  template<std::size_t Width, typename... Ts>
+  static inline bool operator!=(ChunkIterator<Width, Ts...> const& lhs, ChunkIterator<Width, Ts...> const& rhs) {
+	  return !lhs.equals(rhs);
+  }
+
+  /**
+   * @details
+   * Range of the full blocks of Width elements, the rest\n
+   * of the elements, which are less than Width, is available\n
+   * as the scalar tail() zipped range.\n
+   * */
+  template<std::size_t Width, typename Zip, typename Sentinel, typename... Ts>
+  class ZipChunks {
+  public:
+	  using iterator = ChunkIterator<Width, Ts...>;
+	  using tail_type = iterator_range<Zip, Sentinel>;
+
+	  ZipChunks(std::tuple<Ts*...> bases, std::size_t full, tail_type tail)
+			  : bases (bases)
+			  , full (full)
+			  , tail_ (std::move(tail))
+	  {}
+
+	  iterator begin() const { return iterator (bases, 0u); }
+	  iterator end() const { return iterator (bases, full); }
+	  std::size_t size() const { return full / Width; }
+	  tail_type tail() const { return tail_; }
+
+  private:
+	  std::tuple<Ts*...> bases;
+	  std::size_t full;
+	  tail_type tail_;
+  };
+
+#ifndef __cpp_concepts
+  template<typename... Containers>
+#else
+  template<culib::requirements::AreAllContainers... Containers>
+#endif
+  class Zipper : private base::utils::ContainerStorage<std::index_sequence_for<Containers...>, Containers...> {
+  private:
+	  using Storage = base::utils::ContainerStorage<std::index_sequence_for<Containers...>, Containers...>;
+	  using Indices = std::index_sequence_for<Containers...>;
+
+	  template<std::size_t Index>
+	  using ContainerAt = std::tuple_element_t<Index, std::tuple<Containers...>>;
+
+	  template<std::size_t Index>
+	  static constexpr bool is_owned { !std::is_lvalue_reference_v<ContainerAt<Index>> };
+
+	  /**
+	   * @details
+	   * This seemingly innocent iterator type selection serves\n
+	   * as a guard - no Type without an iterator can pass this.\n
+	   * \n
+	   * */
+	  template<typename Input>
+	  using IteratorTypeSelect = std::conditional_t<
+			  std::is_const_v<std::remove_reference_t<Input>>,
+			  typename std::remove_reference_t<Input>::const_iterator,
+			  typename std::remove_reference_t<Input>::iterator>;
+
+	  template<typename Input>
+	  using IteratorCategorySelect = typename std::iterator_traits<IteratorTypeSelect<Input>>::iterator_category;
+
+	  template<typename Input>
+	  using ElementTypeSelect = std::remove_reference_t<typename std::iterator_traits<IteratorTypeSelect<Input>>::reference>;
+
+  public:
+	  /**
+	   * @details
+	   * If every container knows its length, either by size()\n
+	   * or by being a random access one, then the shortest length is\n
+	   * computed once and the loop is checked against the end\n
+	   * of the leading iterator only, not all of them.\n
+	   * */
+	  static constexpr bool is_sized {
+			  ((culib::requirements::is_sized_v<Containers> ||
+				culib::requirements::areAllRandomAccess_v<IteratorCategorySelect<Containers>>()) && ...) };
+	  static constexpr std::size_t lead { base::utils::leadIndex<IteratorCategorySelect<Containers>...>() };
+	  static constexpr bool is_random_access {
+			  culib::requirements::areAllRandomAccess_v<IteratorCategorySelect<Containers>...>() };
+	  /**
+	   * @details
+	   * If no container is owned, so the views of a temporary\n
+	   * Zipper refer to the containers, not to the Zipper.\n
+	   * */
+	  static constexpr bool is_borrowed { (std::is_lvalue_reference_v<Containers> && ...) };
+
+	  using zip_type = ZipIterator<IteratorTypeSelect<Containers>...>;
+	  using sentinel_type = std::conditional_t<is_sized,
+			  zip_sentinel<zip_type, lead>,
+			  typename base::utils::FullSentinel<zip_type, std::index_sequence_for<Containers...>>::type>;
+
+	  Zipper() = delete;
+
+#ifndef __cpp_concepts
+	  template<culib::requirements::AreAllContainers<Containers...> = true>
+#endif
+	  explicit
+	  Zipper(Containers&&... inputs) : Zipper(Indices{}, std::forward<Containers>(inputs)...)
+	  {}
+
+	  /**
+	   * @details
+	   * The owned containers are moved or copied along with\n
+	   * the Zipper, so the iterators into them are restored\n
+	   * at the same positions of the new storage.\n
+	   * */
+	  Zipper(Zipper const& other) : Zipper(other, other.offsets(), Indices{})
+	  {}
+	  Zipper(Zipper&& other) : Zipper(std::move(other), other.offsets(), Indices{})
+	  {}
+
+	  Zipper& operator = (Zipper const& other) {
+		  if (this != &other) assign(other, other.offsets(), Indices{});
+		  return *this;
+	  }
+	  Zipper& operator = (Zipper&& other) {
+		  if (this != &other) assign(std::move(other), other.offsets(), Indices{});
+		  return *this;
+	  }
+
+	  zip_type begin() const { return begin_ ; }
+	  zip_type& begin() { return begin_ ; }
+	  sentinel_type end() const { return end_; }
+
+#ifndef __cpp_concepts
+	  template<bool Sized = is_sized, std::enable_if_t<Sized, bool> = true>
+#endif
+	  std::size_t size() const
+#ifdef __cpp_concepts
+	  requires is_sized
+#endif
+	  { return size_; }
+
+	  /**
+	   * @details
+	   * Iterating over blocks of Width elements, when all of the\n
+	   * containers are contiguous, the tuples of std::span<T, Width>\n
+	   * (or span_block in C++17) are provided, so a kernel may run\n
+	   * over the columns in the SIMD fashion. The remainder is\n
+	   * provided by tail() of the result, as a usual zipped range.\n
+	   * The blocks point into the owned containers, so those are\n
+	   * not taken from a temporary Zipper, that owns any.\n
+	   * */
+#ifndef __cpp_concepts
+	  template<
+			  std::size_t Width,
+			  bool Contiguous = culib::requirements::areAllContiguous_v<Containers...>(),
+			  std::enable_if_t<Contiguous, bool> = true>
+#else
+	  template<std::size_t Width>
+#endif
+	  auto chunks() const&
+#ifdef __cpp_concepts
+	  requires culib::requirements::AreAllContiguous<Containers...>
+#endif
+	  {
+		  static_assert(Width > 0u, "Chunk width should be positive");
+		  using Chunks = ZipChunks<Width, zip_type, sentinel_type, ElementTypeSelect<Containers>...>;
+
+		  auto const full {size_ / Width * Width};
+		  auto tail_begin {begin_};
+		  tail_begin += static_cast<typename zip_type::difference_type>(full);
+		  return Chunks (addresses(std::index_sequence_for<Containers...>{}), full, {tail_begin, end_});
+	  }
+#ifndef __cpp_concepts
+	  template<std::size_t Width, bool Borrowed = is_borrowed, std::enable_if_t<!Borrowed, bool> = true>
+	  void chunks() const&& = delete;
+#else
+	  template<std::size_t Width>
+	  void chunks() const&& requires (!is_borrowed) = delete;
+#endif
+
+	  /**
+	   * @details
+	   * Every step-th row of a random access zip, starting\n
+	   * from the first one. The rows are reached by the O(1)\n
+	   * indexing, so nothing is stepped over one by one.\n
+	   * A step past the size gives the first row only.\n
+	   * The rows refer to the owned containers, so those are not\n
+	   * taken from a temporary Zipper, that owns any.\n
+	   * */
+#ifndef __cpp_concepts
+	  template<bool RandomAccess = is_random_access, std::enable_if_t<RandomAccess, bool> = true>
+#endif
+	  auto stride(std::size_t step) const&
+#ifdef __cpp_concepts
+	  requires is_random_access
+#endif
+	  {
+		  if (step == 0u) throw std::invalid_argument("stride: the step should be positive");
+		  using Strided = stride_iterator<zip_type>;
+		  using Diff = typename zip_type::difference_type;
+		  // no step + size overflow, and the step fits Diff, as it is not greater than the size
+		  step = std::min(step, std::max<std::size_t>(size_, 1u));
+		  auto const rows {static_cast<Diff>(size_ == 0u ? 0u : (size_ - 1u) / step + 1u)};
+		  return iterator_range<Strided>(Strided (begin_, static_cast<Diff>(step), 0), Strided (begin_, static_cast<Diff>(step), rows));
+	  }
+#ifndef __cpp_concepts
+	  template<bool Borrowed = is_borrowed, std::enable_if_t<!Borrowed, bool> = true>
+	  void stride(std::size_t) const&& = delete;
+#else
+	  void stride(std::size_t) const&& requires (!is_borrowed) = delete;
+#endif
+
+	  /**
+	   * @details
+	   * Rows [from, to) of a random access zip, both bounds are\n
+	   * clamped to the size, both ends are found in O(1).\n
+	   * Same as stride(), not for a temporary owning Zipper.\n
+	   * */
+#ifndef __cpp_concepts
+	  template<bool RandomAccess = is_random_access, std::enable_if_t<RandomAccess, bool> = true>
+#endif
+	  auto slice(std::size_t from, std::size_t to) const&
+#ifdef __cpp_concepts
+	  requires is_random_access
+#endif
+	  {
+		  using Diff = typename zip_type::difference_type;
+		  to = std::min(to, size_);
+		  from = std::min(from, to);
+		  return iterator_range<zip_type>(begin_ + static_cast<Diff>(from), begin_ + static_cast<Diff>(to));
+	  }
+#ifndef __cpp_concepts
+	  template<bool Borrowed = is_borrowed, std::enable_if_t<!Borrowed, bool> = true>
+	  void slice(std::size_t, std::size_t) const&& = delete;
+#else
+	  void slice(std::size_t, std::size_t) const&& requires (!is_borrowed) = delete;
+#endif
+
+  private:
+	  std::size_t size_;
+	  zip_type begin_;
+	  sentinel_type end_;
+
+	  struct Offsets {
+		  std::ptrdiff_t begin[sizeof...(Containers)];
+		  std::ptrdiff_t end[sizeof...(Containers)];
+	  };
+
+	  template<std::size_t... I>
+	  Zipper(std::index_sequence<I...>, Containers&&... inputs)
+			  : Storage (std::forward<Containers>(inputs)...)
+			  , size_ (makeSize(containerAt<I>(inputs)...))
+			  , begin_ (containerAt<I>(inputs).begin()...)
+			  , end_ (makeEnd(containerAt<I>(inputs)...))
+	  {}
+
+	  template<typename Other, std::size_t... I>
+	  Zipper(Other&& other, Offsets const& offsets, std::index_sequence<I...>)
+			  : Storage (std::forward<Other>(other))
+			  , size_ (other.size_)
+			  , begin_ (rebased<I>(other.begin_.template base<I>(), offsets.begin[I])...)
+			  , end_ (rebasedEnd(other.end_, offsets))
+	  {}
+
+	  template<typename Other, std::size_t... I>
+	  void assign(Other&& other, Offsets const& offsets, std::index_sequence<I...>) {
+		  static_cast<Storage&>(*this) = static_cast<std::conditional_t<std::is_lvalue_reference_v<Other>, Storage const&, Storage&&>>(other);
+		  size_ = other.size_;
+		  begin_ = zip_type (rebased<I>(other.begin_.template base<I>(), offsets.begin[I])...);
+		  end_ = rebasedEnd(other.end_, offsets);
+	  }
+
+	  /**
+	   * @details
+	   * Owned container is taken from the storage, the borrowed one\n
+	   * is the input itself.\n
+	   * */
+	  template<std::size_t Index, typename Input>
+	  auto& containerAt(Input& input) {
+		  if constexpr (is_owned<Index>) {
+			  return ownedAt<Index>();
+		  }
+		  else {
+			  return (input);
+		  }
+	  }
+
+	  template<std::size_t Index>
+	  auto& ownedAt() const {
+		  return static_cast<base::utils::ContainerHolder<Index, ContainerAt<Index>> const&>(*this).value;
+	  }
+
+	  template<std::size_t Index>
+	  auto& ownedAt() {
+		  return static_cast<base::utils::ContainerHolder<Index, ContainerAt<Index>>&>(*this).value;
+	  }
+
+	  Offsets offsets() const {
+		  Offsets result {};
+		  offsetsImpl(result, Indices{});
+		  return result;
+	  }
+
+	  template<std::size_t... I>
+	  void offsetsImpl(Offsets& result, std::index_sequence<I...>) const {
+		  (offsetInto<I>(result.begin[I], begin_.template base<I>()), ...);
+		  endOffsets(result, end_);
+	  }
+
+	  template<std::size_t... Tracked>
+	  void endOffsets(Offsets& result, zip_sentinel<zip_type, Tracked...> const& end) const {
+		  (offsetInto<Tracked>(result.end[Tracked], end.template last<Tracked>()), ...);
+	  }
+
+	  template<std::size_t Index, typename Iterator>
+	  void offsetInto(std::ptrdiff_t& offset, Iterator const& it) const {
+		  if constexpr (is_owned<Index>) {
+			  offset = base::utils::offsetOf(it, ownedAt<Index>());
+		  }
+	  }
+
+	  template<std::size_t Index, typename Iterator>
+	  Iterator rebased(Iterator const& it, std::ptrdiff_t offset) {
+		  if constexpr (is_owned<Index>) {
+			  return base::utils::iteratorAt<Iterator>(offset, ownedAt<Index>());
+		  }
+		  else {
+			  return it;
+		  }
+	  }
+
+	  template<std::size_t... Tracked>
+	  zip_sentinel<zip_type, Tracked...> rebasedEnd(zip_sentinel<zip_type, Tracked...> const& end, Offsets const& offsets) {
+		  return zip_sentinel<zip_type, Tracked...> (rebased<Tracked>(end.template last<Tracked>(), offsets.end[Tracked])...);
+	  }
+
+	  template<std::size_t... I>
+	  auto addresses(std::index_sequence<I...>) const {
+		  return std::tuple<ElementTypeSelect<Containers>*...> (
+				  (size_ == 0u ? nullptr : std::addressof(*begin_.template base<I>()))...);
+	  }
+
+	  template<typename... Inputs>
+	  static std::size_t makeSize(Inputs&... inputs) {
+		  if constexpr (is_sized) {
+			  return base::utils::minSize(inputs...);
+		  }
+		  else {
+			  return 0u;
+		  }
+	  }
+
+	  template<typename... Inputs>
+	  sentinel_type makeEnd(Inputs&... inputs) const {
+		  if constexpr (is_sized) {
+			  return sentinel_type (base::utils::advancedBegin(std::get<lead>(std::tie(inputs...)), size_));
+		  }
+		  else {
+			  return sentinel_type (inputs.end()...);
+		  }
+	  }
+  };
+
+  /**
+   * @details
+   * Considering all the options, there should be at least a pair\n
+   * of iterators to provide a valid range.\n\n
+   * So all of the inputs should satisfy the requirements to have\n
+   * both .begin() and end(), therefore each argument is, or  \n
+   * should be, a container.\n
+   *
+   * */
+
+#ifndef __cpp_concepts
+  template<typename... Containers, culib::requirements::AreAllContainers<Containers...> = true>
+#else
+  template<culib::requirements::AreAllContainers... Containers>
+#endif
+  auto zip(Containers&&... containers) {
+	  return Zipper<Containers...> (std::forward<Containers>(containers)...);
+  }
+
+  /**
+   * @details
+   * Zip of the columns, that should be of the same length.\n
+   * The lengths are checked once, here, and a mismatch is thrown\n
+   * as std::length_error, before anything is iterated, instead\n
+   * of being silently truncated. Then the loop checks the end\n
+   * of the leading iterator only.\n
+   * Every column should know its length in O(1), by size() or\n
+   * by the random access iterators, so the check is O(1). The\n
+   * unsized ones, like std::forward_list or a generator, are\n
+   * rejected at compile time, as their lengths are known only\n
+   * at the end of the iteration - zip(...) truncates those.\n
+   * */
+#ifndef __cpp_concepts
+  template<typename... Containers, culib::requirements::AreAllContainers<Containers...> = true>
+#else
+  template<culib::requirements::AreAllContainers... Containers>
+#endif
+  auto zip_strict(Containers&&... containers) {
+	  using Zip = Zipper<Containers...>;
+	  static_assert(Zip::is_sized, "zip_strict requires the containers with size() or random access iterators");
+	  if (!base::utils::sameSize(containers...)) {
+		  throw std::length_error("zip_strict: the containers are of different lengths");
+	  }
+	  return Zip (std::forward<Containers>(containers)...);
+  }
+
+  /**
+   * @details
+   * Zip of the row numbers and the containers, the numbers\n
+   * are a counting_range column, that is the leading one, so\n
+   * the loop checks its counter only, if the zip is sized.\n
+   * */
+#ifndef __cpp_concepts
+  template<typename... Containers, culib::requirements::AreAllContainers<Containers...> = true>
+#else
+  template<culib::requirements::AreAllContainers... Containers>
+#endif
+  auto enumerate(Containers&&... containers) {
+	  return Zipper<counting_range<>, Containers...> (counting_range<>{}, std::forward<Containers>(containers)...);
+  }
+  /**
+   * @details
+   * Just a ZipIterator will be provided from this func.\n
+   * */
+
+#ifndef __cpp_concepts
+  template<typename... Iterators, culib::requirements::AreAllIterators<Iterators...> = true>
+#else
+  template<culib::requirements::AreAllIterators... Iterators>
+#endif
+  auto zip(Iterators&&... iterators) {
+	  return ZipIterator<Iterators...> (std::forward<Iterators>(iterators)...);
+  }
+
+  }//!namespace
+
+}//!namespace
+
+
+/**
+ * @details
+ * Extending namespace std:: for user-defined structural binding.\n
+ *
+ * */
+
+namespace std {
+  template<typename... Iterators>
+  struct tuple_size<itertools::ZipIterator<Iterators...>> :
   public std::integral_constant<std::size_t, sizeof...(Iterators)> {};
 
 template<std::size_t Index, typename... Iterators>
@@ -307,6 +1576,48 @@ struct tuple_element<Index, itertools::ZipIterator<Iterators...>> {
 	using type = decltype(std::get<Index>(std::declval<itertools::ZipIterator<Iterators...>>().operator*() ));
 };
 
+  template<typename... Refs>
+  struct tuple_size<itertools::zip_reference<Refs...>> :
+  public std::integral_constant<std::size_t, sizeof...(Refs)> {};
+
+template<std::size_t Index, typename... Refs>
+struct tuple_element<Index, itertools::zip_reference<Refs...>> {
+	using type = std::tuple_element_t<Index, std::tuple<Refs...>>;
+};
+
+#ifdef __cpp_concepts
+  /**
+   * @details
+   * Common references of the zipped references and the tuples\n
+   * of values, so the zipped iterators are indirectly readable.\n
+   * */
+  template<typename... Ts, typename... Us, template<typename> class TQual, template<typename> class UQual>
+  requires (sizeof...(Ts) == sizeof...(Us))
+  struct basic_common_reference<itertools::zip_reference<Ts...>, itertools::zip_reference<Us...>, TQual, UQual> {
+	  using type = itertools::zip_reference<std::common_reference_t<TQual<Ts>, UQual<Us>>...>;
+  };
+
+  template<typename... Ts, typename... Us, template<typename> class TQual, template<typename> class UQual>
+  requires (sizeof...(Ts) == sizeof...(Us))
+  struct basic_common_reference<itertools::zip_reference<Ts...>, std::tuple<Us...>, TQual, UQual> {
+	  using type = itertools::zip_reference<std::common_reference_t<TQual<Ts>, UQual<Us>>...>;
+  };
+
+  template<typename... Ts, typename... Us, template<typename> class TQual, template<typename> class UQual>
+  requires (sizeof...(Ts) == sizeof...(Us))
+  struct basic_common_reference<std::tuple<Ts...>, itertools::zip_reference<Us...>, TQual, UQual> {
+	  using type = itertools::zip_reference<std::common_reference_t<TQual<Ts>, UQual<Us>>...>;
+  };
+
+  template<typename... Containers>
+  inline constexpr bool ranges::enable_borrowed_range<itertools::Zipper<Containers...>> {
+		  (std::is_lvalue_reference_v<Containers> && ...) };
+
+  template<typename... Containers>
+  inline constexpr bool ranges::enable_view<itertools::Zipper<Containers...>> {
+		  (std::is_lvalue_reference_v<Containers> && ...) };
+#endif
+
 
 }//!namespace
 
@@ -0,0 +1,197 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#ifndef ITERTOOLS_BUFFERED_H
+#define ITERTOOLS_BUFFERED_H
+
+namespace itertools {
+
+  /**
+   * @details
+   * End of a buffered zip, the iterator knows by itself\n
+   * if the sources are exhausted.\n
+   * */
+  struct buffered_zip_end {};
+
+  /**
+   * @details
+   * Zip over the single pass sources, like std::istream_iterator\n
+   * ranges or generators. Each of the sources is read in batches\n
+   * of up to Batch elements into its own buffer, one source\n
+   * at a time, and the zipped rows are the references into\n
+   * the buffers. The source iterators are never copied or\n
+   * compared to each other, only to their own ends, once per\n
+   * element read, while the loop itself checks one counter.\n\n
+   * An rvalue range is owned by the zip, an lvalue one is\n
+   * referenced, as Zipper does with the containers. It is neither\n
+   * copied nor moved, as its iterators refer to it.\n
+   * */
+  template<std::size_t Batch, typename... Ranges>
+  class BufferedZipper {
+  private:
+	  static_assert(Batch > 0u, "Batch should be positive");
+
+	  template<typename Range>
+	  using IteratorFor = std::decay_t<decltype(std::declval<Range&>().begin())>;
+
+	  template<typename Range>
+	  using EndFor = std::decay_t<decltype(std::declval<Range&>().end())>;
+
+	  template<typename Range>
+	  using ValueFor = typename std::iterator_traits<IteratorFor<Range>>::value_type;
+
+	  template<typename Range>
+	  struct Source {
+		  IteratorFor<Range> current;
+		  EndFor<Range> last;
+		  std::vector<ValueFor<Range>> buffer;
+
+		  Source(IteratorFor<Range> first, EndFor<Range> last)
+				  : current (std::move(first))
+				  , last (std::move(last))
+		  {
+			  buffer.reserve(Batch);
+		  }
+
+		  std::size_t refill(std::size_t limit) {
+			  buffer.clear();
+			  for (; buffer.size() != limit && !(current == last); ++current) {
+				  buffer.push_back(*current);
+			  }
+			  return buffer.size();
+		  }
+	  };
+
+  public:
+	  using value_type = std::tuple<ValueFor<Ranges>...>;
+	  using reference = zip_reference<ValueFor<Ranges>&...>;
+
+	  class iterator {
+	  public:
+		  using iterator_category = std::input_iterator_tag;
+		  using value_type = BufferedZipper::value_type;
+		  using reference = BufferedZipper::reference;
+		  using pointer = void;
+		  using difference_type = std::ptrdiff_t;
+
+		  iterator() = default;
+		  explicit
+		  iterator(BufferedZipper* zipper) : zipper (zipper)
+		  {}
+
+		  reference operator*() const { return zipper->current(); }
+		  iterator& operator++() {
+			  zipper->next();
+			  return *this;
+		  }
+		  /**
+		   * @details
+		   * Single pass, so there is no previous state to be returned.\n
+		   * */
+		  void operator++(int) { zipper->next(); }
+
+		  friend bool operator==(iterator const& it, buffered_zip_end) { return it.done(); }
+		  friend bool operator==(buffered_zip_end, iterator const& it) { return it.done(); }
+		  friend bool operator!=(iterator const& it, buffered_zip_end) { return !it.done(); }
+		  friend bool operator!=(buffered_zip_end, iterator const& it) { return !it.done(); }
+
+	  private:
+		  BufferedZipper* zipper {nullptr};
+
+		  bool done() const { return zipper->done(); }
+	  };
+
+	  explicit
+	  BufferedZipper(Ranges&&... ranges)
+			  : ranges (std::forward<Ranges>(ranges)...)
+			  , sources (makeSources(std::index_sequence_for<Ranges...>{}))
+	  {}
+	  BufferedZipper(BufferedZipper const&) = delete;
+	  BufferedZipper& operator = (BufferedZipper const&) = delete;
+
+	  /**
+	   * @details
+	   * The first batch is read here, so it is a single pass\n
+	   * thing as well - the second begin() continues the loop.\n
+	   * */
+	  iterator begin() {
+		  if (!started) {
+			  started = true;
+			  refill();
+		  }
+		  return iterator (this);
+	  }
+	  buffered_zip_end end() const { return {}; }
+
+  private:
+	  std::tuple<Ranges...> ranges;
+	  std::tuple<Source<Ranges>...> sources;
+	  std::size_t position {0u};
+	  std::size_t filled {0u};
+	  bool started {false};
+
+	  template<std::size_t... I>
+	  std::tuple<Source<Ranges>...> makeSources(std::index_sequence<I...>) {
+		  return {Source<Ranges>(std::get<I>(ranges).begin(), std::get<I>(ranges).end())...};
+	  }
+
+	  reference current() const {
+		  return currentImpl(std::index_sequence_for<Ranges...>{});
+	  }
+
+	  template<std::size_t... I>
+	  reference currentImpl(std::index_sequence<I...>) const {
+		  return reference (const_cast<ValueFor<Ranges>&>(std::get<I>(sources).buffer[position])...);
+	  }
+
+	  /**
+	   * @details
+	   * A short batch is the last one, so the sources are\n
+	   * not read any further.\n
+	   * */
+	  void next() {
+		  if (++position == filled && filled == Batch) refill();
+	  }
+
+	  bool done() const { return position == filled; }
+
+	  /**
+	   * @details
+	   * A source gives less than Batch elements only being exhausted,\n
+	   * then it is the shortest one, and the zip stops after this batch.\n
+	   * The sources after it read no more than it has given, but\n
+	   * the ones before it have already read up to Batch - 1 elements\n
+	   * past the last row, those are not seen by the loop.\n
+	   * */
+	  void refill() {
+		  position = 0u;
+		  filled = Batch;
+		  std::apply([this](auto&... source) { ((filled = source.refill(filled)), ...); }, sources);
+	  }
+  };
+
+  /**
+   * @details
+   * Zips the single pass ranges, reading them in the batches\n
+   * of Batch elements, see BufferedZipper.\n
+   * */
+  template<std::size_t Batch = 256u, typename... Ranges>
+  auto buffered_zip(Ranges&&... ranges) {
+	  return BufferedZipper<Batch, Ranges...> (std::forward<Ranges>(ranges)...);
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_BUFFERED_H
@@ -0,0 +1,201 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include <vector>
+#include <iterator>
+#include <exception>
+#include <utility>
+#include <type_traits>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define ITERTOOLS_HAS_COROUTINES
+#endif
+
+#ifndef ITERTOOLS_GENERATOR_H
+#define ITERTOOLS_GENERATOR_H
+
+#ifdef ITERTOOLS_HAS_COROUTINES
+
+namespace itertools {
+
+  /**
+   * @details
+   * Coroutine, that produces a column on the fly, to be zipped\n
+   * with the containers and with the other generators:\n
+   * generator<int> numbers() { for (int i = 0;; ++i) co_yield i; }\n
+   * zip(numbers(), words)\n
+   * The values are not handed over one by one: co_yield puts\n
+   * a value into the buffer of Batch elements and the coroutine\n
+   * runs on, it is suspended only when the buffer is full, so\n
+   * there is one resume per Batch values, and no more than Batch\n
+   * of them are kept in the memory at a time.\n\n
+   * It is a single pass range, begin() starts the coroutine,\n
+   * the copies of an iterator share the position. A zip of it\n
+   * is to be iterated in place, not copied. An exception thrown\n
+   * by the coroutine is rethrown by the increment past the last\n
+   * value yielded before it.\n
+   * */
+  template<typename T, std::size_t Batch = 64u>
+  class generator {
+  public:
+	  static_assert(Batch > 0u, "Batch should be positive");
+
+	  /**
+	   * @details
+	   * Suspends the coroutine, if the batch is full.\n
+	   * */
+	  struct batch_awaiter {
+		  bool full;
+
+		  bool await_ready() const noexcept { return !full; }
+		  void await_suspend(std::coroutine_handle<>) const noexcept {}
+		  void await_resume() const noexcept {}
+	  };
+
+	  struct promise_type {
+		  std::vector<T> buffer;
+		  std::size_t position {0u};
+		  std::exception_ptr error;
+
+		  promise_type() { buffer.reserve(Batch); }
+
+		  generator get_return_object() {
+			  return generator (std::coroutine_handle<promise_type>::from_promise(*this));
+		  }
+		  std::suspend_always initial_suspend() noexcept { return {}; }
+		  std::suspend_always final_suspend() noexcept { return {}; }
+		  void return_void() noexcept {}
+		  void unhandled_exception() { error = std::current_exception(); }
+
+		  /**
+		   * @details
+		   * The coroutine is not suspended, unless the buffer is full.\n
+		   * */
+		  template<typename U = T>
+		  batch_awaiter yield_value(U&& value) {
+			  buffer.emplace_back(std::forward<U>(value));
+			  return {buffer.size() == Batch};
+		  }
+
+		  /**
+		   * @details
+		   * Resumes the coroutine, until the next batch is ready\n
+		   * or it is done, returns if there are values to be read.\n
+		   * An exception is kept, until the values yielded before\n
+		   * it are read.\n
+		   * */
+		  bool refill(std::coroutine_handle<promise_type> handle) {
+			  buffer.clear();
+			  position = 0u;
+			  if (error) std::rethrow_exception(std::exchange(error, nullptr));
+			  while (!handle.done() && buffer.size() != Batch) handle.resume();
+			  if (error && buffer.empty()) std::rethrow_exception(std::exchange(error, nullptr));
+			  return !buffer.empty();
+		  }
+	  };
+
+	  class iterator {
+	  public:
+		  using iterator_category = std::input_iterator_tag;
+		  using value_type = T;
+		  using difference_type = std::ptrdiff_t;
+		  using reference = T&;
+		  using pointer = T*;
+
+		  iterator() = default;
+		  explicit
+		  iterator(std::coroutine_handle<promise_type> handle) : handle (handle)
+		  {}
+
+		  reference operator*() const {
+			  auto& promise {handle.promise()};
+			  return promise.buffer[promise.position];
+		  }
+		  pointer operator->() const { return &**this; }
+
+		  iterator& operator++() {
+			  auto& promise {handle.promise()};
+			  if (++promise.position == promise.buffer.size() && !promise.refill(handle)) handle = nullptr;
+			  return *this;
+		  }
+		  void operator++(int) { ++*this; }
+
+		  /**
+		   * @details
+		   * The end is the iterator with no coroutine,\n
+		   * an exhausted one drops its coroutine.\n
+		   * */
+		  friend bool operator==(iterator const& lhs, iterator const& rhs) { return lhs.handle == rhs.handle; }
+		  friend bool operator!=(iterator const& lhs, iterator const& rhs) { return !(lhs == rhs); }
+
+	  private:
+		  std::coroutine_handle<promise_type> handle;
+	  };
+
+	  /**
+	   * @details
+	   * Only to be named by the zip, a const generator\n
+	   * can't be iterated, as begin() resumes it.\n
+	   * */
+	  using const_iterator = iterator;
+
+	  generator() = default;
+	  generator(generator const&) = delete;
+	  generator& operator = (generator const&) = delete;
+
+	  generator(generator&& other) noexcept
+			  : handle (std::exchange(other.handle, nullptr))
+			  , started (std::exchange(other.started, false))
+	  {}
+	  generator& operator = (generator&& other) noexcept {
+		  if (this != &other) {
+			  destroy();
+			  handle = std::exchange(other.handle, nullptr);
+			  started = std::exchange(other.started, false);
+		  }
+		  return *this;
+	  }
+
+	  ~generator() { destroy(); }
+
+	  /**
+	   * @details
+	   * The first batch is produced here, so, like the rest\n
+	   * of the single pass things, the second begin() continues\n
+	   * from where the first one stopped.\n
+	   * */
+	  iterator begin() {
+		  if (!handle) return {};
+		  auto& promise {handle.promise()};
+		  if (!started) {
+			  started = true;
+			  if (!promise.refill(handle)) return {};
+		  }
+		  if (promise.position == promise.buffer.size()) return {};
+		  return iterator (handle);
+	  }
+	  iterator end() { return {}; }
+
+  private:
+	  std::coroutine_handle<promise_type> handle;
+	  bool started {false};
+
+	  explicit
+	  generator(std::coroutine_handle<promise_type> handle) : handle (handle)
+	  {}
+
+	  void destroy() {
+		  if (handle) handle.destroy();
+		  handle = nullptr;
+	  }
+  };
+
+}//!namespace
+
+#endif //ITERTOOLS_HAS_COROUTINES
+
+#endif //ITERTOOLS_GENERATOR_H
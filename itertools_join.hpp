@@ -0,0 +1,457 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+
+#include <vector>
+#include <tuple>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+#ifndef ITERTOOLS_JOIN_H
+#define ITERTOOLS_JOIN_H
+
+namespace itertools {
+
+  enum class join_mode { inner, left_outer, full_outer };
+
+  /**
+   * @details
+   * A row of a join - the iterators to the matched elements,\n
+   * an outer join provides the rows with one of the sides missing,\n
+   * the iterator of that side should not be dereferenced then.\n
+   * */
+  template<typename LeftIterator, typename RightIterator>
+  class join_row {
+  public:
+	  join_row(LeftIterator left, RightIterator right, bool has_left, bool has_right)
+			  : left_ (std::move(left))
+			  , right_ (std::move(right))
+			  , has_left_ (has_left)
+			  , has_right_ (has_right)
+	  {}
+
+	  bool has_left() const { return has_left_; }
+	  bool has_right() const { return has_right_; }
+
+	  decltype(auto) left() const { return *left_; }
+	  decltype(auto) right() const { return *right_; }
+
+	  LeftIterator const& left_iterator() const { return left_; }
+	  RightIterator const& right_iterator() const { return right_; }
+
+  private:
+	  LeftIterator left_;
+	  RightIterator right_;
+	  bool has_left_;
+	  bool has_right_;
+  };
+
+  /**
+   * @details
+   * End of a merge join, the iterator knows by itself,\n
+   * when both of the sides are done.\n
+   * */
+  struct merge_join_end {};
+
+  namespace base::utils {
+	inline void prefetchLine(void const* address) {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address);
+#else
+		(void)address;
+#endif
+	}
+
+	/**
+	 * @details
+	 * First position in [first, last), that is not before the value:\n
+	 * key < value for the lower bound, !(value < key) for the upper one.\n
+	 * The first element is known to be before the value. A random\n
+	 * access range is probed at 1, 2, 4... positions ahead and then\n
+	 * the last step is searched in binary, so skipping k elements\n
+	 * is O(log k), others are stepped one by one.\n
+	 * */
+	template<bool Upper, typename Iterator, typename Sentinel, typename Value, typename Key>
+	Iterator gallop(Iterator first, Sentinel const& last, Value const& value, Key const& key) {
+		auto before = [&value, &key](auto const& row) {
+			if constexpr (Upper) return !(value < key(row));
+			else return key(row) < value;
+		};
+		if constexpr (is_random_access_iterator_v<Iterator>) {
+			using Diff = typename std::iterator_traits<Iterator>::difference_type;
+			auto const n {static_cast<Diff>(last - first)};
+			Diff lo {0}, step {1};
+			while (step < n && before(first[step])) {
+				lo = step;
+				step *= 2;
+			}
+			auto count {std::min(step, n) - lo - 1};
+			first += lo + 1;
+			while (count > 0) {
+				auto const half {count / 2};
+				auto const middle {first + half};
+				if (before(*middle)) {
+					first = middle + 1;
+					count -= half + 1;
+				}
+				else {
+					count = half;
+				}
+			}
+			return first;
+		}
+		else {
+			while (!(first == last) && before(*first)) ++first;
+			return first;
+		}
+	}
+  }//!namespace
+
+  /**
+   * @details
+   * Join of two ranges, both sorted by their keys, the rows\n
+   * are matched by the keys, not by the positions, as zip does.\n
+   * Equal keys give all of the pairs of their groups. An inner\n
+   * join skips the unmatched rows by galloping, when the range\n
+   * is random access, so sparse joins take a sublinear time.\n
+   * The outer joins provide the unmatched rows of the left\n
+   * (and the right) side as well, with the other side missing.\n
+   * The ranges are kept as Zipper keeps the containers: lvalues\n
+   * are referenced, rvalues are owned. The iterators refer to\n
+   * the join, it should not be moved while being iterated.\n
+   * */
+  template<typename Left, typename Right, typename KeyLeft, typename KeyRight>
+  class MergeJoin {
+  private:
+	  using LeftIterator = std::decay_t<decltype(std::declval<Left&>().begin())>;
+	  using LeftSentinel = std::decay_t<decltype(std::declval<Left&>().end())>;
+	  using RightIterator = std::decay_t<decltype(std::declval<Right&>().begin())>;
+	  using RightSentinel = std::decay_t<decltype(std::declval<Right&>().end())>;
+
+  public:
+	  using row_type = join_row<LeftIterator, RightIterator>;
+
+	  class iterator {
+	  public:
+		  using iterator_category = std::input_iterator_tag;
+		  using value_type = row_type;
+		  using reference = row_type;
+		  using difference_type = std::ptrdiff_t;
+		  using pointer = void;
+
+		  iterator() = default;
+		  explicit
+		  iterator(MergeJoin* join)
+				  : join (join)
+				  , l (join->left.begin())
+				  , r (join->right.begin())
+		  {
+			  satisfy();
+		  }
+
+		  reference operator*() const {
+			  switch (kind) {
+				  case Kind::pair: return row_type (gi, gj, true, true);
+				  case Kind::left_only: return row_type (l, r, true, false);
+				  default: return row_type (l, r, false, true);
+			  }
+		  }
+
+		  iterator& operator++() {
+			  switch (kind) {
+				  case Kind::pair:
+					  if (++gj == rg) {
+						  gj = r;
+						  if (++gi == lg) {
+							  l = lg;
+							  r = rg;
+							  satisfy();
+						  }
+					  }
+					  break;
+				  case Kind::left_only:
+					  ++l;
+					  satisfy();
+					  break;
+				  case Kind::right_only:
+					  ++r;
+					  satisfy();
+					  break;
+				  case Kind::done:
+					  break;
+			  }
+			  return *this;
+		  }
+		  void operator++(int) { ++*this; }
+
+		  friend bool operator==(iterator const& it, merge_join_end) { return it.kind == Kind::done; }
+		  friend bool operator==(merge_join_end, iterator const& it) { return it.kind == Kind::done; }
+		  friend bool operator!=(iterator const& it, merge_join_end) { return it.kind != Kind::done; }
+		  friend bool operator!=(merge_join_end, iterator const& it) { return it.kind != Kind::done; }
+
+	  private:
+		  enum class Kind { pair, left_only, right_only, done };
+
+		  MergeJoin* join {nullptr};
+		  LeftIterator l, lg, gi;
+		  RightIterator r, rg, gj;
+		  Kind kind {Kind::done};
+
+		  /**
+		   * @details
+		   * Finds the next row to be provided, starting at l and r.\n
+		   * */
+		  void satisfy() {
+			  LeftSentinel const lend {join->left.end()};
+			  RightSentinel const rend {join->right.end()};
+			  auto const mode {join->mode};
+			  for (;;) {
+				  bool const left_done {l == lend}, right_done {r == rend};
+				  if (left_done || right_done) {
+					  if (!left_done && mode != join_mode::inner) kind = Kind::left_only;
+					  else if (!right_done && mode == join_mode::full_outer) kind = Kind::right_only;
+					  else kind = Kind::done;
+					  return;
+				  }
+				  auto const left_key {join->key_left(*l)};
+				  auto const right_key {join->key_right(*r)};
+				  if (left_key < right_key) {
+					  if (mode != join_mode::inner) {
+						  kind = Kind::left_only;
+						  return;
+					  }
+					  l = base::utils::gallop<false>(l, lend, right_key, join->key_left);
+				  }
+				  else if (right_key < left_key) {
+					  if (mode == join_mode::full_outer) {
+						  kind = Kind::right_only;
+						  return;
+					  }
+					  r = base::utils::gallop<false>(r, rend, left_key, join->key_right);
+				  }
+				  else {
+					  lg = base::utils::gallop<true>(l, lend, left_key, join->key_left);
+					  rg = base::utils::gallop<true>(r, rend, right_key, join->key_right);
+					  gi = l;
+					  gj = r;
+					  kind = Kind::pair;
+					  return;
+				  }
+			  }
+		  }
+	  };
+
+	  MergeJoin(Left&& left, Right&& right, KeyLeft key_left, KeyRight key_right, join_mode mode)
+			  : left (std::forward<Left>(left))
+			  , right (std::forward<Right>(right))
+			  , key_left (std::move(key_left))
+			  , key_right (std::move(key_right))
+			  , mode (mode)
+	  {}
+	  MergeJoin(MergeJoin const&) = delete;
+	  MergeJoin& operator = (MergeJoin const&) = delete;
+
+	  iterator begin() { return iterator (this); }
+	  merge_join_end end() const { return {}; }
+
+  private:
+	  Left left;
+	  Right right;
+	  KeyLeft key_left;
+	  KeyRight key_right;
+	  join_mode mode;
+  };
+
+  /**
+   * @details
+   * Joins the sorted ranges (containers, zips...) by the keys,\n
+   * key_left(row) and key_right(row), see MergeJoin.\n
+   * */
+  template<typename Left, typename Right, typename KeyLeft, typename KeyRight>
+  auto merge_join(Left&& left, Right&& right, KeyLeft key_left, KeyRight key_right, join_mode mode = join_mode::inner) {
+	  return MergeJoin<Left, Right, KeyLeft, KeyRight>(
+			  std::forward<Left>(left), std::forward<Right>(right), std::move(key_left), std::move(key_right), mode);
+  }
+
+  /**
+   * @details
+   * End of a hash join, the iterator knows by itself,\n
+   * when the probe range is done.\n
+   * */
+  struct hash_join_end {};
+
+  /**
+   * @details
+   * Join of a probe range against a hash map: the rows are\n
+   * (probe row, mapped value) for the rows with key_fn(row)\n
+   * found in the map, the others are skipped.\n
+   * The rows are resolved in the blocks of Batch, in the phases:\n
+   * the keys of a block are hashed into their buckets, then\n
+   * the bucket heads are loaded and their nodes prefetched, and\n
+   * only then the chains are walked. A key is hashed once.\n
+   * Note, the standard map gives no address of a bucket slot,\n
+   * so that load can't be prefetched, and the CPU overlaps\n
+   * the independent find() calls by itself: in the bench it is\n
+   * on par with a plain find() loop, within the noise.\n
+   * The probe range is kept as Zipper keeps the containers,\n
+   * the map is referenced or owned as well. The iterators\n
+   * refer to the join, so it is neither copied nor moved.\n
+   * */
+  template<std::size_t Batch, typename Probe, typename Map, typename KeyFn>
+  class HashJoin {
+  private:
+	  static_assert(Batch > 0u, "Batch should be positive");
+
+	  using ProbeIterator = std::decay_t<decltype(std::declval<Probe&>().begin())>;
+	  using ProbeSentinel = std::decay_t<decltype(std::declval<Probe&>().end())>;
+	  using ProbeReference = typename std::iterator_traits<ProbeIterator>::reference;
+	  using Key = std::decay_t<decltype(std::declval<KeyFn&>()(std::declval<ProbeReference>()))>;
+	  using MappedReference = decltype((std::declval<Map&>().begin()->second));
+	  using LocalIterator = decltype(std::declval<Map&>().begin(std::size_t{}));
+
+	  static_assert(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<ProbeIterator>::iterator_category>,
+					"The probe rows are revisited after the lookups, so the probe range should be multipass");
+
+  public:
+	  using value_type = std::tuple<ProbeReference, MappedReference>;
+	  using reference = value_type;
+
+	  class iterator {
+	  public:
+		  using iterator_category = std::input_iterator_tag;
+		  using value_type = HashJoin::value_type;
+		  using reference = HashJoin::reference;
+		  using pointer = void;
+		  using difference_type = std::ptrdiff_t;
+
+		  iterator() = default;
+		  explicit
+		  iterator(HashJoin* join) : join (join)
+		  {}
+
+		  reference operator*() const { return join->current(); }
+		  iterator& operator++() {
+			  join->next();
+			  return *this;
+		  }
+		  void operator++(int) { join->next(); }
+
+		  friend bool operator==(iterator const& it, hash_join_end) { return it.done(); }
+		  friend bool operator==(hash_join_end, iterator const& it) { return it.done(); }
+		  friend bool operator!=(iterator const& it, hash_join_end) { return !it.done(); }
+		  friend bool operator!=(hash_join_end, iterator const& it) { return !it.done(); }
+
+	  private:
+		  HashJoin* join {nullptr};
+
+		  bool done() const { return join->done(); }
+	  };
+
+	  HashJoin(Probe&& probe, Map&& map, KeyFn key_fn)
+			  : probe (std::forward<Probe>(probe))
+			  , map (std::forward<Map>(map))
+			  , key_fn (std::move(key_fn))
+			  , row (this->probe.begin())
+	  {
+		  rows.reserve(Batch);
+		  keys.reserve(Batch);
+		  buckets.reserve(Batch);
+		  heads.reserve(Batch);
+		  matches.reserve(Batch);
+	  }
+	  HashJoin(HashJoin const&) = delete;
+	  HashJoin& operator = (HashJoin const&) = delete;
+
+	  /**
+	   * @details
+	   * The first block is resolved here, the second begin()\n
+	   * continues the loop.\n
+	   * */
+	  iterator begin() {
+		  if (!started) {
+			  started = true;
+			  refill();
+		  }
+		  return iterator (this);
+	  }
+	  hash_join_end end() const { return {}; }
+
+  private:
+	  Probe probe;
+	  Map map;
+	  KeyFn key_fn;
+	  ProbeIterator row;
+	  std::vector<ProbeIterator> rows;
+	  std::vector<Key> keys;
+	  std::vector<std::size_t> buckets;
+	  std::vector<LocalIterator> heads;
+	  std::vector<std::pair<ProbeIterator, std::remove_reference_t<MappedReference>*>> matches;
+	  std::size_t position {0u};
+	  bool started {false};
+
+	  reference current() const {
+		  auto const& [it, mapped] = matches[position];
+		  return reference (*it, *mapped);
+	  }
+
+	  void next() {
+		  if (++position == matches.size()) refill();
+	  }
+
+	  bool done() const { return position == matches.size(); }
+
+	  /**
+	   * @details
+	   * Resolves the blocks, until there is a match or the probe\n
+	   * range is done.\n
+	   * */
+	  void refill() {
+		  position = 0u;
+		  matches.clear();
+		  ProbeSentinel const last {probe.end()};
+		  while (matches.empty() && !(row == last)) {
+			  rows.clear();
+			  keys.clear();
+			  buckets.clear();
+			  heads.clear();
+			  for (; rows.size() != Batch && !(row == last); ++row) {
+				  rows.push_back(row);
+				  keys.push_back(key_fn(*row));
+			  }
+			  if (map.empty()) continue;
+			  for (auto const& key : keys) buckets.push_back(map.bucket(key));
+			  for (auto bucket : buckets) {
+				  heads.push_back(map.begin(bucket));
+				  if (heads.back() != map.end(bucket)) base::utils::prefetchLine(std::addressof(*heads.back()));
+			  }
+			  for (std::size_t i = 0; i != rows.size(); ++i) {
+				  for (auto node = heads[i], end = map.end(buckets[i]); node != end; ++node) {
+					  if (map.key_eq()(node->first, keys[i])) {
+						  matches.emplace_back(rows[i], std::addressof(node->second));
+						  break;
+					  }
+				  }
+			  }
+		  }
+	  }
+  };
+
+  /**
+   * @details
+   * Looks up key_fn(row) of the rows of the probe range (a container,\n
+   * a zip...) in the map, in the blocks of Batch, see HashJoin.\n
+   * */
+  template<std::size_t Batch = 64u, typename Probe, typename Map, typename KeyFn>
+  auto hash_join(Probe&& probe, Map&& map, KeyFn key_fn) {
+	  return HashJoin<Batch, Probe, Map, KeyFn>(std::forward<Probe>(probe), std::forward<Map>(map), std::move(key_fn));
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_JOIN_H
@@ -0,0 +1,265 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+#include "itertools_parallel.hpp"
+
+#include <optional>
+#include <vector>
+#include <iterator>
+#include <functional>
+#include <algorithm>
+#include <utility>
+#include <tuple>
+#include <type_traits>
+
+#ifndef ITERTOOLS_NUMERIC_H
+#define ITERTOOLS_NUMERIC_H
+
+namespace itertools {
+
+  namespace base::utils {
+	/**
+	 * @details
+	 * The rows are split into the chunks of this fixed length,\n
+	 * not into a chunk per thread, so the partial results, and\n
+	 * the order those are combined in, do not depend on the number\n
+	 * of threads - a floating point sum is the same for any pool.\n
+	 * */
+	inline constexpr std::size_t reduce_chunk_rows {1u << 14u};
+
+	inline std::size_t reduceChunks(std::size_t total) {
+		return (total + reduce_chunk_rows - 1u) / reduce_chunk_rows;
+	}
+
+	/**
+	 * @details
+	 * Default transform of inclusive_scan - the element\n
+	 * of a single column zip.\n
+	 * */
+	struct SoleColumn {
+		template<typename Row>
+		auto operator()(Row const& row) const {
+			static_assert(std::tuple_size_v<std::decay_t<Row>> == 1u, "A transform should be provided for the rows of several columns");
+			return std::get<0>(row);
+		}
+	};
+
+	/**
+	 * @details
+	 * Runs task for every chunk, by the pool, if there is one,\n
+	 * or serially, the chunks are the same either way.\n
+	 * */
+	template<typename Task>
+	void forChunks(thread_pool* pool, std::size_t chunks, Task& task) {
+		if (pool != nullptr && chunks > 1u) {
+			pool->run(chunks, task);
+		}
+		else {
+			for (std::size_t chunk = 0; chunk != chunks; ++chunk) task(chunk);
+		}
+	}
+
+	/**
+	 * @details
+	 * If Transform can be applied to a row of the Range,\n
+	 * so a number of threads is not taken for a transform.\n
+	 * */
+	template<typename Transform, typename Range>
+	inline constexpr bool is_row_transform_v {
+			std::is_invocable_v<Transform&, decltype(*std::declval<Range&>().begin())> };
+
+	template<typename Iterator>
+	Iterator advancedBy(Iterator it, std::size_t n) {
+		it += static_cast<typename std::iterator_traits<Iterator>::difference_type>(n);
+		return it;
+	}
+
+	template<typename Range, typename T, typename Reduce, typename Transform>
+	T transformReduceSerial(Range& zipper, T init, Reduce& reduce, Transform& transform) {
+		for (auto it = zipper.begin(), end = zipper.end(); it != end; ++it) {
+			init = reduce(std::move(init), transform(*it));
+		}
+		return init;
+	}
+
+	template<typename Range, typename T, typename Reduce, typename Transform>
+	T transformReduceChunked(Range& zipper, T init, Reduce& reduce, Transform& transform, thread_pool* pool) {
+		auto const total {static_cast<std::size_t>(zipper.size())};
+		auto const chunks {reduceChunks(total)};
+		std::vector<std::optional<T>> partials (chunks);
+
+		auto task = [&](std::size_t chunk) {
+			auto const from {chunk * reduce_chunk_rows}, to {std::min(total, from + reduce_chunk_rows)};
+			auto it {advancedBy(zipper.begin(), from)};
+			T partial (transform(*it));
+			for (auto i = from + 1; i != to; ++i) {
+				++it;
+				partial = reduce(std::move(partial), transform(*it));
+			}
+			partials[chunk].emplace(std::move(partial));
+		};
+		forChunks(pool, chunks, task);
+
+		for (auto& partial : partials) {
+			init = reduce(std::move(init), std::move(*partial));
+		}
+		return init;
+	}
+
+	template<typename Range, typename Output, typename Op, typename Transform>
+	Output inclusiveScanSerial(Range& zipper, Output out, Op& op, Transform& transform) {
+		using T = std::decay_t<decltype(transform(*zipper.begin()))>;
+		auto it {zipper.begin()};
+		auto const end {zipper.end()};
+		if (it == end) return out;
+
+		T acc (transform(*it));
+		*out = acc;
+		for (++it, ++out; it != end; ++it, ++out) {
+			acc = op(std::move(acc), transform(*it));
+			*out = acc;
+		}
+		return out;
+	}
+
+	/**
+	 * @details
+	 * Every chunk is scanned by itself, then the totals\n
+	 * of the preceding chunks are added to each chunk, except\n
+	 * the first one, in a second parallel pass.\n
+	 * */
+	template<typename Range, typename Output, typename Op, typename Transform>
+	Output inclusiveScanChunked(Range& zipper, Output out, Op& op, Transform& transform, thread_pool* pool) {
+		using T = std::decay_t<decltype(transform(*zipper.begin()))>;
+		auto const total {static_cast<std::size_t>(zipper.size())};
+		auto const chunks {reduceChunks(total)};
+		std::vector<std::optional<T>> totals (chunks);
+
+		auto scan = [&](std::size_t chunk) {
+			auto const from {chunk * reduce_chunk_rows}, to {std::min(total, from + reduce_chunk_rows)};
+			auto it {advancedBy(zipper.begin(), from)};
+			auto o {advancedBy(out, from)};
+			T acc (transform(*it));
+			*o = acc;
+			for (auto i = from + 1; i != to; ++i) {
+				++it;
+				++o;
+				acc = op(std::move(acc), transform(*it));
+				*o = acc;
+			}
+			totals[chunk].emplace(std::move(acc));
+		};
+		forChunks(pool, chunks, scan);
+
+		// carries[c] is the total of the chunks before c
+		std::vector<std::optional<T>> carries (chunks);
+		for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+			if (chunk == 1u) carries[chunk].emplace(std::move(*totals[0]));
+			else carries[chunk].emplace(op(*carries[chunk - 1], std::move(*totals[chunk - 1])));
+		}
+
+		auto carry = [&](std::size_t chunk) {
+			if (chunk == 0u) return;
+			auto const from {chunk * reduce_chunk_rows}, to {std::min(total, from + reduce_chunk_rows)};
+			auto o {advancedBy(out, from)};
+			for (auto i = from; i != to; ++i, ++o) {
+				*o = op(*carries[chunk], *o);
+			}
+		};
+		forChunks(pool, chunks, carry);
+		return advancedBy(out, total);
+	}
+  }//!namespace
+
+  /**
+   * @details
+   * Reduces transform(row) over the rows of a zip, as\n
+   * std::transform_reduce does, reduce should be associative.\n
+   * A random access zip is split into the chunks of a fixed\n
+   * length, those are reduced by the pool, and the partial\n
+   * results are combined in the order of the chunks, so the result\n
+   * is the same for any number of threads. Other zips are reduced\n
+   * serially.\n
+   * */
+  template<typename Range, typename T, typename Reduce, typename Transform>
+  T transform_reduce(Range&& zipper, T init, Reduce reduce, Transform transform, thread_pool& pool) {
+	  if constexpr (base::utils::is_random_access_range_v<Range>) {
+		  return base::utils::transformReduceChunked(zipper, std::move(init), reduce, transform, &pool);
+	  }
+	  else {
+		  return base::utils::transformReduceSerial(zipper, std::move(init), reduce, transform);
+	  }
+  }
+
+  template<typename Range, typename T, typename Reduce, typename Transform>
+  T transform_reduce(Range&& zipper, T init, Reduce reduce, Transform transform, std::size_t threads = std::thread::hardware_concurrency()) {
+	  if constexpr (base::utils::is_random_access_range_v<Range>) {
+		  if (threads > 1u && zipper.size() > base::utils::reduce_chunk_rows) {
+			  thread_pool pool (threads);
+			  return base::utils::transformReduceChunked(zipper, std::move(init), reduce, transform, &pool);
+		  }
+		  return base::utils::transformReduceChunked(zipper, std::move(init), reduce, transform, nullptr);
+	  }
+	  else {
+		  return base::utils::transformReduceSerial(zipper, std::move(init), reduce, transform);
+	  }
+  }
+
+  /**
+   * @details
+   * Running totals of transform(row), written to out, as\n
+   * std::inclusive_scan does, op should be associative. The default\n
+   * transform takes the element of a single column zip, then\n
+   * the number of threads may follow op right away.\n
+   * A random access zip with a random access out is scanned\n
+   * by the chunks of a fixed length in two parallel passes, the second\n
+   * one adds the totals of the preceding chunks, so the result\n
+   * is the same for any number of threads. Otherwise, it is serial.\n
+   * */
+  template<typename Range, typename Output, typename Op, typename Transform>
+  Output inclusive_scan(Range&& zipper, Output out, Op op, Transform transform, thread_pool& pool) {
+	  if constexpr (base::utils::is_random_access_range_v<Range> && base::utils::is_random_access_iterator_v<Output>) {
+		  return base::utils::inclusiveScanChunked(zipper, std::move(out), op, transform, &pool);
+	  }
+	  else {
+		  return base::utils::inclusiveScanSerial(zipper, std::move(out), op, transform);
+	  }
+  }
+
+  template<typename Range, typename Output, typename Op>
+  Output inclusive_scan(Range&& zipper, Output out, Op op, thread_pool& pool) {
+	  return inclusive_scan(std::forward<Range>(zipper), std::move(out), std::move(op), base::utils::SoleColumn{}, pool);
+  }
+
+#ifndef __cpp_concepts
+  template<typename Range, typename Output, typename Op, typename Transform = base::utils::SoleColumn,
+		  std::enable_if_t<base::utils::is_row_transform_v<Transform, Range>, bool> = true>
+#else
+  template<typename Range, typename Output, typename Op, typename Transform = base::utils::SoleColumn>
+  requires base::utils::is_row_transform_v<Transform, Range>
+#endif
+  Output inclusive_scan(Range&& zipper, Output out, Op op, Transform transform = {}, std::size_t threads = std::thread::hardware_concurrency()) {
+	  if constexpr (base::utils::is_random_access_range_v<Range> && base::utils::is_random_access_iterator_v<Output>) {
+		  if (threads > 1u && zipper.size() > base::utils::reduce_chunk_rows) {
+			  thread_pool pool (threads);
+			  return base::utils::inclusiveScanChunked(zipper, std::move(out), op, transform, &pool);
+		  }
+		  return base::utils::inclusiveScanChunked(zipper, std::move(out), op, transform, nullptr);
+	  }
+	  else {
+		  return base::utils::inclusiveScanSerial(zipper, std::move(out), op, transform);
+	  }
+  }
+
+  template<typename Range, typename Output, typename Op>
+  Output inclusive_scan(Range&& zipper, Output out, Op op, std::size_t threads) {
+	  return inclusive_scan(std::forward<Range>(zipper), std::move(out), std::move(op), base::utils::SoleColumn{}, threads);
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_NUMERIC_H
@@ -0,0 +1,243 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <exception>
+#include <utility>
+
+#ifndef ITERTOOLS_PARALLEL_H
+#define ITERTOOLS_PARALLEL_H
+
+namespace itertools {
+
+  /**
+   * @details
+   * Work stealing thread pool, that runs a batch of indexed tasks\n
+   * and blocks until all of them are done. The calling thread\n
+   * takes part in the work as well.\n\n
+   * Each participant owns a queue, filled by a contiguous block\n
+   * of task indices. It takes the tasks from the front of its own\n
+   * queue and, being out of work, steals from the back of the others.\n
+   * */
+  class thread_pool {
+  public:
+	  explicit
+	  thread_pool(std::size_t threads = std::thread::hardware_concurrency())
+			  : queues (std::max<std::size_t>(threads, 1u))
+	  {
+		  workers.reserve(queues.size() - 1);
+		  for (std::size_t i = 0; i != queues.size() - 1; ++i) {
+			  workers.emplace_back([this, i]{ loop(i); });
+		  }
+	  }
+	  thread_pool(thread_pool const&) = delete;
+	  thread_pool& operator = (thread_pool const&) = delete;
+
+	  ~thread_pool() {
+		  {
+			  std::lock_guard<std::mutex> lock (mutex);
+			  stop = true;
+		  }
+		  wake.notify_all();
+		  for (auto& worker : workers) worker.join();
+	  }
+
+	  /**
+	   * @details
+	   * Number of threads doing the work, including the calling one.\n
+	   * */
+	  std::size_t size() const { return queues.size(); }
+
+	  /**
+	   * @details
+	   * Calls task(i) for every i in [0, count), the first exception\n
+	   * thrown by a task is rethrown here once all the tasks are done.\n
+	   * A task, that calls run() of the same pool, would wait for\n
+	   * the threads busy with the outer run, so such a nested run\n
+	   * is done inline, by the calling thread.\n
+	   * */
+	  template<typename Task>
+	  void run(std::size_t count, Task& task) {
+		  if (count == 0u) return;
+		  if (running == this) {
+			  for (std::size_t i = 0; i != count; ++i) task(i);
+			  return;
+		  }
+		  std::lock_guard<std::mutex> run_lock (run_mutex);
+
+		  context = std::addressof(task);
+		  invoke = [](void* ctx, std::size_t index) { (*static_cast<Task*>(ctx))(index); };
+		  error = nullptr;
+		  remaining.store(count);
+
+		  auto const participants {queues.size()};
+		  for (std::size_t q = 0; q != participants; ++q) {
+			  std::lock_guard<std::mutex> lock (queues[q].mutex);
+			  for (std::size_t i = q * count / participants, last = (q + 1) * count / participants; i != last; ++i) {
+				  queues[q].tasks.push_back(i);
+			  }
+		  }
+		  {
+			  std::lock_guard<std::mutex> lock (mutex);
+			  ++generation;
+		  }
+		  wake.notify_all();
+
+		  work(participants - 1);
+		  {
+			  std::unique_lock<std::mutex> lock (mutex);
+			  done.wait(lock, [this]{ return remaining.load() == 0u; });
+		  }
+		  if (error) std::rethrow_exception(error);
+	  }
+
+  private:
+	  struct Queue {
+		  std::mutex mutex;
+		  std::deque<std::size_t> tasks;
+	  };
+
+	  std::vector<Queue> queues;
+	  std::vector<std::thread> workers;
+
+	  std::mutex run_mutex;
+	  std::mutex mutex;
+	  std::condition_variable wake, done;
+	  std::size_t generation {0u};
+	  bool stop {false};
+
+	  std::atomic<std::size_t> remaining {0u};
+	  void (*invoke)(void*, std::size_t) {nullptr};
+	  void* context {nullptr};
+	  std::mutex error_mutex;
+	  std::exception_ptr error;
+
+	  /**
+	   * @details
+	   * Pool, whose task the thread is running now, if any.\n
+	   * */
+	  static inline thread_local thread_pool* running {nullptr};
+
+	  bool pop(std::size_t self, std::size_t& index) {
+		  {
+			  std::lock_guard<std::mutex> lock (queues[self].mutex);
+			  if (!queues[self].tasks.empty()) {
+				  index = queues[self].tasks.front();
+				  queues[self].tasks.pop_front();
+				  return true;
+			  }
+		  }
+		  for (std::size_t shift = 1; shift != queues.size(); ++shift) {
+			  auto& victim {queues[(self + shift) % queues.size()]};
+			  std::lock_guard<std::mutex> lock (victim.mutex);
+			  if (!victim.tasks.empty()) {
+				  index = victim.tasks.back();
+				  victim.tasks.pop_back();
+				  return true;
+			  }
+		  }
+		  return false;
+	  }
+
+	  void work(std::size_t self) {
+		  std::size_t index;
+		  while (pop(self, index)) {
+			  auto const outer {std::exchange(running, this)};
+			  try {
+				  invoke(context, index);
+			  }
+			  catch (...) {
+				  std::lock_guard<std::mutex> lock (error_mutex);
+				  if (!error) error = std::current_exception();
+			  }
+			  running = outer;
+			  if (remaining.fetch_sub(1u) == 1u) {
+				  std::lock_guard<std::mutex> lock (mutex);
+				  done.notify_all();
+			  }
+		  }
+	  }
+
+	  void loop(std::size_t self) {
+		  std::size_t seen {0u};
+		  for (;;) {
+			  {
+				  std::unique_lock<std::mutex> lock (mutex);
+				  wake.wait(lock, [this, &seen]{ return stop || generation != seen; });
+				  if (stop) return;
+				  seen = generation;
+			  }
+			  work(self);
+		  }
+	  }
+  };
+
+  namespace base::utils {
+	template<typename Range>
+	inline constexpr bool is_random_access_range_v {
+			culib::requirements::areAllRandomAccess_v<
+					typename std::decay_t<decltype(std::declval<Range&>().begin())>::iterator_category>() };
+
+	/**
+	 * @details
+	 * Amount of chunks per thread, more than one lets\n
+	 * the idle threads to steal some work.\n
+	 * */
+	inline constexpr std::size_t chunks_per_thread {4u};
+  }//!namespace
+
+  /**
+   * @details
+   * Calls fn for every tuple of the zipped range. A random access\n
+   * range is split into contiguous chunks, those are run by the pool,\n
+   * any other range is iterated serially.\n
+   * */
+  template<typename Range, typename Function>
+  void parallel_for_each(Range&& zipper, Function fn, thread_pool& pool) {
+	  if constexpr (base::utils::is_random_access_range_v<Range>) {
+		  auto const total {zipper.size()};
+		  auto const chunks {std::min(total, pool.size() * base::utils::chunks_per_thread)};
+		  auto task = [&zipper, &fn, total, chunks](std::size_t chunk) {
+			  auto const from {chunk * total / chunks}, to {(chunk + 1) * total / chunks};
+			  auto it {zipper.begin()};
+			  it += static_cast<typename std::decay_t<decltype(it)>::difference_type>(from);
+			  for (auto i = from; i != to; ++i, ++it) {
+				  fn(*it);
+			  }
+		  };
+		  pool.run(chunks, task);
+	  }
+	  else {
+		  for (auto it = zipper.begin(), end = zipper.end(); it != end; ++it) {
+			  fn(*it);
+		  }
+	  }
+  }
+
+  template<typename Range, typename Function>
+  void parallel_for_each(Range&& zipper, Function fn, std::size_t threads = std::thread::hardware_concurrency()) {
+	  if constexpr (base::utils::is_random_access_range_v<Range>) {
+		  if (threads > 1u) {
+			  thread_pool pool (threads);
+			  parallel_for_each(std::forward<Range>(zipper), std::move(fn), pool);
+			  return;
+		  }
+	  }
+	  for (auto it = zipper.begin(), end = zipper.end(); it != end; ++it) {
+		  fn(*it);
+	  }
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_PARALLEL_H
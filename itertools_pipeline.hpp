@@ -0,0 +1,394 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+
+#include <functional>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+
+#ifndef ITERTOOLS_PIPELINE_H
+#define ITERTOOLS_PIPELINE_H
+
+namespace itertools {
+
+  namespace base::utils {
+	/**
+	 * @details
+	 * Base of the adaptors, that are accepted by the operator|.\n
+	 * */
+	struct PipeAdaptor {};
+
+	template<typename T>
+	inline constexpr bool is_pipe_adaptor_v {std::is_base_of_v<PipeAdaptor, std::decay_t<T>>};
+
+	template<typename Range>
+	using RangeIterator = std::decay_t<decltype(std::declval<Range&>().begin())>;
+
+	template<typename Range>
+	using RangeSentinel = std::decay_t<decltype(std::declval<Range&>().end())>;
+
+	template<typename Iterator>
+	using IteratorCategoryOf = typename std::iterator_traits<Iterator>::iterator_category;
+
+	/**
+	 * @details
+	 * The pipeline iterators do not go backwards, so those are\n
+	 * forward ones at most.\n
+	 * */
+	template<typename Iterator>
+	using PipeCategory = std::common_type_t<IteratorCategoryOf<Iterator>, std::forward_iterator_tag>;
+  }//!namespace
+
+  /**
+   * @details
+   * End of a pipeline stage, just the end of the range below it.\n
+   * */
+  template<typename Sentinel>
+  struct pipe_sentinel {
+	  Sentinel last;
+  };
+
+  /**
+   * @details
+   * Skips the rows, that do not satisfy the predicate.\n
+   * The Range is kept by a reference, if it is an lvalue,\n
+   * and it is owned otherwise, as Zipper does with the containers.\n
+   * The iterators refer to the predicate of the view, so\n
+   * the view should not be moved while being iterated.\n
+   * */
+  template<typename Range, typename Pred>
+  class filter_view {
+  private:
+	  using BaseIterator = base::utils::RangeIterator<Range>;
+	  using BaseSentinel = base::utils::RangeSentinel<Range>;
+
+  public:
+	  class iterator {
+	  public:
+		  using iterator_category = base::utils::PipeCategory<BaseIterator>;
+		  using value_type = typename std::iterator_traits<BaseIterator>::value_type;
+		  using difference_type = typename std::iterator_traits<BaseIterator>::difference_type;
+		  using reference = typename std::iterator_traits<BaseIterator>::reference;
+		  using pointer = void;
+
+		  iterator() = default;
+		  iterator(BaseIterator current, BaseSentinel last, Pred const* pred)
+				  : current (std::move(current))
+				  , last (std::move(last))
+				  , pred (pred)
+		  {
+			  satisfy();
+		  }
+
+		  reference operator*() const { return *current; }
+		  iterator& operator++() {
+			  ++current;
+			  satisfy();
+			  return *this;
+		  }
+		  iterator operator++(int) {
+			  auto tmp {*this};
+			  ++*this;
+			  return tmp;
+		  }
+
+		  friend bool operator==(iterator const& lhs, iterator const& rhs) { return lhs.current == rhs.current; }
+		  friend bool operator!=(iterator const& lhs, iterator const& rhs) { return !(lhs == rhs); }
+		  friend bool operator==(iterator const& it, pipe_sentinel<BaseSentinel> const& end) { return it.current == end.last; }
+		  friend bool operator==(pipe_sentinel<BaseSentinel> const& end, iterator const& it) { return it.current == end.last; }
+		  friend bool operator!=(iterator const& it, pipe_sentinel<BaseSentinel> const& end) { return !(it.current == end.last); }
+		  friend bool operator!=(pipe_sentinel<BaseSentinel> const& end, iterator const& it) { return !(it.current == end.last); }
+
+	  private:
+		  BaseIterator current;
+		  BaseSentinel last;
+		  Pred const* pred {nullptr};
+
+		  void satisfy() {
+			  while (!(current == last) && !std::invoke(*pred, *current)) ++current;
+		  }
+	  };
+
+	  filter_view(Range&& range, Pred pred)
+			  : range (std::forward<Range>(range))
+			  , pred (std::move(pred))
+	  {}
+
+	  iterator begin() { return iterator (range.begin(), range.end(), &pred); }
+	  pipe_sentinel<BaseSentinel> end() { return {range.end()}; }
+
+  private:
+	  Range range;
+	  Pred pred;
+  };
+
+  /**
+   * @details
+   * Applies the function to every row, when it is dereferenced.\n
+   * */
+  template<typename Range, typename Fn>
+  class transform_view {
+  private:
+	  using BaseIterator = base::utils::RangeIterator<Range>;
+	  using BaseSentinel = base::utils::RangeSentinel<Range>;
+	  using BaseReference = typename std::iterator_traits<BaseIterator>::reference;
+
+  public:
+	  class iterator {
+	  public:
+		  using reference = std::invoke_result_t<Fn const&, BaseReference>;
+		  using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+		  using difference_type = typename std::iterator_traits<BaseIterator>::difference_type;
+		  using iterator_category = std::conditional_t<std::is_reference_v<reference>,
+				  base::utils::PipeCategory<BaseIterator>,
+				  std::input_iterator_tag>;
+		  using pointer = void;
+
+		  iterator() = default;
+		  iterator(BaseIterator current, Fn const* fn)
+				  : current (std::move(current))
+				  , fn (fn)
+		  {}
+
+		  reference operator*() const { return std::invoke(*fn, *current); }
+		  iterator& operator++() {
+			  ++current;
+			  return *this;
+		  }
+		  iterator operator++(int) {
+			  auto tmp {*this};
+			  ++current;
+			  return tmp;
+		  }
+
+		  friend bool operator==(iterator const& lhs, iterator const& rhs) { return lhs.current == rhs.current; }
+		  friend bool operator!=(iterator const& lhs, iterator const& rhs) { return !(lhs == rhs); }
+		  friend bool operator==(iterator const& it, pipe_sentinel<BaseSentinel> const& end) { return it.current == end.last; }
+		  friend bool operator==(pipe_sentinel<BaseSentinel> const& end, iterator const& it) { return it.current == end.last; }
+		  friend bool operator!=(iterator const& it, pipe_sentinel<BaseSentinel> const& end) { return !(it.current == end.last); }
+		  friend bool operator!=(pipe_sentinel<BaseSentinel> const& end, iterator const& it) { return !(it.current == end.last); }
+
+	  private:
+		  BaseIterator current;
+		  Fn const* fn {nullptr};
+	  };
+
+	  transform_view(Range&& range, Fn fn)
+			  : range (std::forward<Range>(range))
+			  , fn (std::move(fn))
+	  {}
+
+	  iterator begin() { return iterator (range.begin(), &fn); }
+	  pipe_sentinel<BaseSentinel> end() { return {range.end()}; }
+
+  private:
+	  Range range;
+	  Fn fn;
+  };
+
+  /**
+   * @details
+   * First n rows of the range, or less, if it is shorter.\n
+   * */
+  template<typename Range>
+  class take_view {
+  private:
+	  using BaseIterator = base::utils::RangeIterator<Range>;
+	  using BaseSentinel = base::utils::RangeSentinel<Range>;
+
+  public:
+	  class iterator {
+	  public:
+		  using iterator_category = base::utils::PipeCategory<BaseIterator>;
+		  using value_type = typename std::iterator_traits<BaseIterator>::value_type;
+		  using difference_type = typename std::iterator_traits<BaseIterator>::difference_type;
+		  using reference = typename std::iterator_traits<BaseIterator>::reference;
+		  using pointer = void;
+
+		  iterator() = default;
+		  iterator(BaseIterator current, std::size_t remaining)
+				  : current (std::move(current))
+				  , remaining (remaining)
+		  {}
+
+		  reference operator*() const { return *current; }
+		  iterator& operator++() {
+			  ++current;
+			  --remaining;
+			  return *this;
+		  }
+		  iterator operator++(int) {
+			  auto tmp {*this};
+			  ++*this;
+			  return tmp;
+		  }
+
+		  friend bool operator==(iterator const& lhs, iterator const& rhs) { return lhs.current == rhs.current; }
+		  friend bool operator!=(iterator const& lhs, iterator const& rhs) { return !(lhs == rhs); }
+		  friend bool operator==(iterator const& it, pipe_sentinel<BaseSentinel> const& end) { return it.isEnd(end); }
+		  friend bool operator==(pipe_sentinel<BaseSentinel> const& end, iterator const& it) { return it.isEnd(end); }
+		  friend bool operator!=(iterator const& it, pipe_sentinel<BaseSentinel> const& end) { return !it.isEnd(end); }
+		  friend bool operator!=(pipe_sentinel<BaseSentinel> const& end, iterator const& it) { return !it.isEnd(end); }
+
+	  private:
+		  BaseIterator current;
+		  std::size_t remaining {0u};
+
+		  bool isEnd(pipe_sentinel<BaseSentinel> const& end) const {
+			  return remaining == 0u || current == end.last;
+		  }
+	  };
+
+	  take_view(Range&& range, std::size_t count)
+			  : range (std::forward<Range>(range))
+			  , count (count)
+	  {}
+
+	  iterator begin() { return iterator (range.begin(), count); }
+	  pipe_sentinel<BaseSentinel> end() { return {range.end()}; }
+
+  private:
+	  Range range;
+	  std::size_t count;
+  };
+
+  /**
+   * @details
+   * The range without its first n rows. Nothing is wrapped,\n
+   * begin() is just the iterator of the range: a sized random\n
+   * access one is advanced in O(1), any other is stepped n times\n
+   * once, and the result is cached, as std::ranges::drop_view does.\n
+   * A copy of the view does not take the cache, as it may point\n
+   * into the range owned by the original.\n
+   * */
+  template<typename Range>
+  class drop_view {
+  private:
+	  using BaseIterator = base::utils::RangeIterator<Range>;
+	  using BaseSentinel = base::utils::RangeSentinel<Range>;
+
+	  static constexpr bool is_indexed {
+			  base::utils::is_random_access_iterator_v<BaseIterator> && culib::requirements::is_sized_v<Range&> };
+
+  public:
+	  drop_view(Range&& range, std::size_t count)
+			  : range (std::forward<Range>(range))
+			  , count (count)
+	  {}
+
+	  drop_view(drop_view const& other)
+			  : range (other.range)
+			  , count (other.count)
+	  {}
+	  drop_view(drop_view&& other)
+			  : range (std::forward<Range>(other.range))
+			  , count (other.count)
+	  {}
+
+	  BaseIterator begin() {
+		  if constexpr (is_indexed) {
+			  using Diff = typename std::iterator_traits<BaseIterator>::difference_type;
+			  BaseIterator first {range.begin()};
+			  first += static_cast<Diff>(std::min(count, static_cast<std::size_t>(range.size())));
+			  return first;
+		  }
+		  else {
+			  if (!first) {
+				  BaseIterator it {range.begin()};
+				  BaseSentinel const last {range.end()};
+				  for (std::size_t i = 0; i != count && !(it == last); ++i) ++it;
+				  first.emplace(std::move(it));
+			  }
+			  return *first;
+		  }
+	  }
+	  BaseSentinel end() { return range.end(); }
+
+  private:
+	  Range range;
+	  std::size_t count;
+	  std::optional<BaseIterator> first;
+  };
+
+  namespace base::utils {
+	template<typename Pred>
+	struct FilterAdaptor : PipeAdaptor {
+		Pred pred;
+
+		template<typename Range>
+		auto operator()(Range&& range) const {
+			return filter_view<Range, Pred>(std::forward<Range>(range), pred);
+		}
+	};
+
+	template<typename Fn>
+	struct TransformAdaptor : PipeAdaptor {
+		Fn fn;
+
+		template<typename Range>
+		auto operator()(Range&& range) const {
+			return transform_view<Range, Fn>(std::forward<Range>(range), fn);
+		}
+	};
+
+	struct TakeAdaptor : PipeAdaptor {
+		std::size_t count;
+
+		template<typename Range>
+		auto operator()(Range&& range) const {
+			return take_view<Range>(std::forward<Range>(range), count);
+		}
+	};
+
+	struct DropAdaptor : PipeAdaptor {
+		std::size_t count;
+
+		template<typename Range>
+		auto operator()(Range&& range) const {
+			return drop_view<Range>(std::forward<Range>(range), count);
+		}
+	};
+
+	/**
+	 * @details
+	 * It is here, next to the adaptors, so it is found by ADL\n
+	 * for any range on the left, a std::vector as well.\n
+	 * */
+#ifndef __cpp_concepts
+	template<typename Range, typename Adaptor, std::enable_if_t<is_pipe_adaptor_v<Adaptor>, bool> = true>
+#else
+	template<typename Range, typename Adaptor>
+	requires is_pipe_adaptor_v<Adaptor>
+#endif
+	static inline auto operator|(Range&& range, Adaptor const& adaptor) {
+		return adaptor(std::forward<Range>(range));
+	}
+  }//!namespace
+
+  /**
+   * @details
+   * Lazy adaptors of a zip (or any range with begin() and end()),\n
+   * zip(a, b) | filter(pred) | transform(fn) | take(n)\n
+   * is a single loop with no intermediate containers, as every\n
+   * stage is just an iterator over the one below it.\n
+   * */
+  template<typename Pred>
+  auto filter(Pred pred) { return base::utils::FilterAdaptor<Pred>{{}, std::move(pred)}; }
+
+  template<typename Fn>
+  auto transform(Fn fn) { return base::utils::TransformAdaptor<Fn>{{}, std::move(fn)}; }
+
+  inline auto take(std::size_t count) { return base::utils::TakeAdaptor{{}, count}; }
+
+  inline auto drop(std::size_t count) { return base::utils::DropAdaptor{{}, count}; }
+
+}//!namespace
+
+#endif //ITERTOOLS_PIPELINE_H
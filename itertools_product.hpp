@@ -0,0 +1,328 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+
+#include <array>
+#include <tuple>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+
+#ifndef ITERTOOLS_PRODUCT_H
+#define ITERTOOLS_PRODUCT_H
+
+namespace itertools {
+
+  /**
+   * @details
+   * Iterator over the cartesian product of the ranges, the last\n
+   * one is the fastest. Like ZipIterator it keeps a tuple of the\n
+   * iterators and provides zip_reference, plus the flat index\n
+   * of the row, that is compared and subtracted in O(1).\n
+   * A step is an odometer increment. If all of the ranges\n
+   * are random access, so is the product: a flat index is decoded\n
+   * into the positions of the dimensions by div and mod, so a grid\n
+   * can be split by the index ranges, or resumed at any row.\n
+   * */
+  template<typename... Iterators>
+  class ProductIterator {
+  private:
+	  template<typename SomeIter>
+	  using ValueTypeFor = typename std::iterator_traits<SomeIter>::value_type;
+
+	  template<typename SomeIter>
+	  using ReferenceTypeFor = typename std::iterator_traits<SomeIter>::reference;
+
+	  template<typename SomeIter>
+	  using IteratorCategoryFor = typename std::iterator_traits<SomeIter>::iterator_category;
+
+	  static constexpr std::size_t dimensions {sizeof...(Iterators)};
+	  static constexpr bool is_random_access {
+			  culib::requirements::areAllRandomAccess_v<IteratorCategoryFor<Iterators>...>() };
+
+  public:
+	  using iterator_category = std::conditional_t<is_random_access,
+			  std::random_access_iterator_tag,
+			  std::common_type_t<IteratorCategoryFor<Iterators>..., std::forward_iterator_tag>>;
+	  using iterator_concept = iterator_category;
+	  using value_type = std::tuple<ValueTypeFor<Iterators>...>;
+	  using reference = zip_reference<ReferenceTypeFor<Iterators>...>;
+	  using difference_type = std::ptrdiff_t;
+	  using pointer = void;
+	  using sizes_type = std::array<difference_type, dimensions>;
+
+	  ProductIterator() = default;
+
+	  /**
+	   * @details
+	   * The iterators are moved to the row index, if those are random\n
+	   * access, otherwise the row should be either the first or\n
+	   * the past the end one, that is never dereferenced.\n
+	   * */
+	  ProductIterator(std::tuple<Iterators...> firsts, sizes_type sizes, difference_type index)
+			  : firsts (firsts)
+			  , currents (std::move(firsts))
+			  , sizes (sizes)
+			  , row (index)
+	  {
+		  if constexpr (is_random_access) decode();
+	  }
+
+	  reference operator*() const { return makeRefs(std::index_sequence_for<Iterators...>{}); }
+
+	  ProductIterator& operator++() {
+		  ++row;
+		  step<dimensions - 1>();
+		  return *this;
+	  }
+	  ProductIterator operator++(int) {
+		  ProductIterator tmp(*this);
+		  operator++();
+		  return tmp;
+	  }
+	  ProductIterator& operator+=(difference_type n) {
+		  if constexpr (is_random_access) {
+			  row += n;
+			  decode();
+		  }
+		  else {
+			  for (difference_type i = 0; i < n; ++i) ++(*this);
+		  }
+		  return *this;
+	  }
+
+#ifndef __cpp_concepts
+	  template<bool RandomAccess = is_random_access, std::enable_if_t<RandomAccess, bool> = true>
+#endif
+	  ProductIterator& operator--()
+#ifdef __cpp_concepts
+	  requires is_random_access
+#endif
+	  {
+		  --row;
+		  decode();
+		  return *this;
+	  }
+
+#ifndef __cpp_concepts
+	  template<bool RandomAccess = is_random_access, std::enable_if_t<RandomAccess, bool> = true>
+#endif
+	  ProductIterator operator--(int)
+#ifdef __cpp_concepts
+	  requires is_random_access
+#endif
+	  {
+		  ProductIterator tmp(*this);
+		  --(*this);
+		  return tmp;
+	  }
+
+#ifndef __cpp_concepts
+	  template<bool RandomAccess = is_random_access, std::enable_if_t<RandomAccess, bool> = true>
+#endif
+	  ProductIterator& operator-=(difference_type n)
+#ifdef __cpp_concepts
+	  requires is_random_access
+#endif
+	  {
+		  row -= n;
+		  decode();
+		  return *this;
+	  }
+
+#ifndef __cpp_concepts
+	  template<bool RandomAccess = is_random_access, std::enable_if_t<RandomAccess, bool> = true>
+#endif
+	  reference operator[](difference_type n) const
+#ifdef __cpp_concepts
+	  requires is_random_access
+#endif
+	  {
+		  ProductIterator tmp(*this);
+		  tmp += n;
+		  return *tmp;
+	  }
+
+	  /**
+	   * @details
+	   * Flat index of the row.\n
+	   * */
+	  difference_type index() const { return row; }
+
+	  /**
+	   * @details
+	   * Position of the row in the dimension Index.\n
+	   * */
+	  template<std::size_t Index>
+	  difference_type offset() const { return offsets[Index]; }
+
+  private:
+	  std::tuple<Iterators...> firsts;
+	  std::tuple<Iterators...> currents;
+	  sizes_type sizes {};
+	  sizes_type offsets {};
+	  difference_type row {0};
+
+	  template <std::size_t... I>
+	  reference makeRefs(std::index_sequence<I...>) const {
+		  return reference (*std::get<I>(currents)...);
+	  }
+
+	  template<std::size_t Dimension>
+	  void step() {
+		  ++std::get<Dimension>(currents);
+		  if (++offsets[Dimension] == sizes[Dimension]) {
+			  if constexpr (Dimension > 0u) {
+				  offsets[Dimension] = 0;
+				  std::get<Dimension>(currents) = std::get<Dimension>(firsts);
+				  step<Dimension - 1>();
+			  }
+		  }
+	  }
+
+	  void decode() {
+		  for (auto size : sizes) {
+			  if (size == 0) return;
+		  }
+		  auto rest {row};
+		  decodeImpl(rest, std::index_sequence_for<Iterators...>{});
+	  }
+
+	  template<std::size_t... I>
+	  void decodeImpl(difference_type& rest, std::index_sequence<I...>) {
+		  (decodeDimension<dimensions - 1 - I>(rest), ...);
+	  }
+
+	  /**
+	   * @details
+	   * The first dimension takes the rest, so the past the end\n
+	   * row is its end and the first positions of the others.\n
+	   * */
+	  template<std::size_t Dimension>
+	  void decodeDimension(difference_type& rest) {
+		  if constexpr (Dimension == 0u) {
+			  offsets[Dimension] = rest;
+		  }
+		  else {
+			  offsets[Dimension] = rest % sizes[Dimension];
+			  rest /= sizes[Dimension];
+		  }
+		  std::get<Dimension>(currents) = std::get<Dimension>(firsts) + offsets[Dimension];
+	  }
+  };
+
+  template<typename... Iterators>
+  static inline bool operator==(ProductIterator<Iterators...> const& lhs, ProductIterator<Iterators...> const& rhs) {
+	  return lhs.index() == rhs.index();
+  }
+
+  template<typename... Iterators>
+  static inline bool operator!=(ProductIterator<Iterators...> const& lhs, ProductIterator<Iterators...> const& rhs) {
+	  return lhs.index() != rhs.index();
+  }
+
+  template<typename... Iterators>
+  static inline bool operator<(ProductIterator<Iterators...> const& lhs, ProductIterator<Iterators...> const& rhs) {
+	  return lhs.index() < rhs.index();
+  }
+
+  template<typename... Iterators>
+  static inline bool operator>(ProductIterator<Iterators...> const& lhs, ProductIterator<Iterators...> const& rhs) {
+	  return lhs.index() > rhs.index();
+  }
+
+  template<typename... Iterators>
+  static inline bool operator<=(ProductIterator<Iterators...> const& lhs, ProductIterator<Iterators...> const& rhs) {
+	  return lhs.index() <= rhs.index();
+  }
+
+  template<typename... Iterators>
+  static inline bool operator>=(ProductIterator<Iterators...> const& lhs, ProductIterator<Iterators...> const& rhs) {
+	  return lhs.index() >= rhs.index();
+  }
+
+  template<typename... Iterators>
+  static inline std::ptrdiff_t operator-(ProductIterator<Iterators...> const& lhs, ProductIterator<Iterators...> const& rhs) {
+	  return lhs.index() - rhs.index();
+  }
+
+  template<typename... Iterators>
+  static inline ProductIterator<Iterators...> operator+(ProductIterator<Iterators...> it, std::ptrdiff_t n) {
+	  it += n;
+	  return it;
+  }
+
+  template<typename... Iterators>
+  static inline ProductIterator<Iterators...> operator+(std::ptrdiff_t n, ProductIterator<Iterators...> it) {
+	  it += n;
+	  return it;
+  }
+
+  template<typename... Iterators>
+  static inline ProductIterator<Iterators...> operator-(ProductIterator<Iterators...> it, std::ptrdiff_t n) {
+	  it -= n;
+	  return it;
+  }
+
+  /**
+   * @details
+   * Cartesian product of the containers, the lvalues are referenced,\n
+   * the rvalues are owned. The iterators are made by begin()\n
+   * and end() from the containers every time, so nothing is to be\n
+   * rebased, when the product is moved.\n
+   * */
+  template<typename... Containers>
+  class Product {
+  private:
+	  template<typename Container>
+	  using IteratorFor = decltype(std::declval<std::remove_reference_t<Container>&>().begin());
+
+  public:
+	  using iterator = ProductIterator<IteratorFor<Containers>...>;
+	  using difference_type = typename iterator::difference_type;
+
+	  explicit
+	  Product(Containers&&... containers) : containers (std::forward<Containers>(containers)...)
+	  {}
+
+	  iterator begin() { return makeIterator(0, std::index_sequence_for<Containers...>{}); }
+	  iterator end() {
+		  return makeIterator(static_cast<difference_type>(size()), std::index_sequence_for<Containers...>{});
+	  }
+
+	  std::size_t size() {
+		  return std::apply([](auto&... c) { return (base::utils::sizeOf(c) * ...); }, containers);
+	  }
+
+  private:
+	  std::tuple<Containers...> containers;
+
+	  template<std::size_t... I>
+	  iterator makeIterator(difference_type index, std::index_sequence<I...>) {
+		  typename iterator::sizes_type const sizes {static_cast<difference_type>(base::utils::sizeOf(std::get<I>(containers)))...};
+		  return iterator (std::make_tuple(std::get<I>(containers).begin()...), sizes, index);
+	  }
+  };
+
+  /**
+   * @details
+   * All the combinations of the elements of the containers,\n
+   * as the nested loops would provide, the last container\n
+   * being the inner loop.\n
+   * */
+#ifndef __cpp_concepts
+  template<typename... Containers, culib::requirements::AreAllContainers<Containers...> = true>
+#else
+  template<culib::requirements::AreAllContainers... Containers>
+#endif
+  auto product(Containers&&... containers) {
+	  return Product<Containers...> (std::forward<Containers>(containers)...);
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_PRODUCT_H
@@ -0,0 +1,242 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+#include "itertools_parallel.hpp"
+
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <tuple>
+
+#ifndef ITERTOOLS_SORT_H
+#define ITERTOOLS_SORT_H
+
+namespace itertools {
+
+  namespace base::utils {
+	inline constexpr std::ptrdiff_t insertion_sort_threshold {16};
+	inline constexpr std::size_t parallel_sort_threshold {1u << 14u};
+
+	/**
+	 * @details
+	 * Compares the rows, either the zipped references or the tuples\n
+	 * of values, by the Key column only.\n
+	 * */
+	template<std::size_t Key, typename Compare>
+	struct KeyCompare {
+		Compare cmp;
+
+		template<typename Lhs, typename Rhs>
+		bool operator()(Lhs const& lhs, Rhs const& rhs) const {
+			return cmp(std::get<Key>(lhs), std::get<Key>(rhs));
+		}
+	};
+
+	inline std::ptrdiff_t depthLimit(std::ptrdiff_t n) {
+		std::ptrdiff_t depth {0};
+		for (; n > 1; n /= 2) depth += 2;
+		return depth;
+	}
+
+	/**
+	 * @details
+	 * Every element is moved by iter_move, and it is written through\n
+	 * the zipped reference, so a row is moved, not copied.\n
+	 * */
+	template<typename Iterator, typename Less>
+	void insertionSort(Iterator first, Iterator last, Less const& less) {
+		using Value = typename Iterator::value_type;
+		if (!(first < last)) return;
+		for (auto i = first + 1; i < last; ++i) {
+			Value tmp = iter_move(i);
+			auto j {i};
+			for (; first < j && less(tmp, *(j - 1)); --j) {
+				*j = iter_move(j - 1);
+			}
+			*j = std::move(tmp);
+		}
+	}
+
+	template<typename Iterator, typename Less>
+	void moveMedianToFirst(Iterator result, Iterator a, Iterator b, Iterator c, Less const& less) {
+		if (less(*a, *b)) {
+			if (less(*b, *c)) iter_swap(result, b);
+			else if (less(*a, *c)) iter_swap(result, c);
+			else iter_swap(result, a);
+		}
+		else if (less(*a, *c)) iter_swap(result, a);
+		else if (less(*b, *c)) iter_swap(result, c);
+		else iter_swap(result, b);
+	}
+
+	/**
+	 * @details
+	 * Pivot is at *pivot, that is out of [first, last), and there are\n
+	 * elements not less and not greater than it on both sides, so\n
+	 * the scans need no bound checks.\n
+	 * */
+	template<typename Iterator, typename Less>
+	Iterator unguardedPartition(Iterator first, Iterator last, Iterator pivot, Less const& less) {
+		for (;;) {
+			while (less(*first, *pivot)) ++first;
+			--last;
+			while (less(*pivot, *last)) --last;
+			if (!(first < last)) return first;
+			iter_swap(first, last);
+			++first;
+		}
+	}
+
+	template<typename Iterator, typename Less>
+	void siftDown(Iterator first, std::ptrdiff_t root, std::ptrdiff_t length, Less const& less) {
+		for (;;) {
+			auto child {2 * root + 1};
+			if (child >= length) return;
+			if (child + 1 < length && less(first[child], first[child + 1])) ++child;
+			if (!less(first[root], first[child])) return;
+			iter_swap(first + root, first + child);
+			root = child;
+		}
+	}
+
+	template<typename Iterator, typename Less>
+	void heapSort(Iterator first, Iterator last, Less const& less) {
+		auto const length {static_cast<std::ptrdiff_t>(last - first)};
+		for (auto root = length / 2; root-- > 0;) {
+			siftDown(first, root, length, less);
+		}
+		for (auto end = length; end > 1; --end) {
+			iter_swap(first, first + (end - 1));
+			siftDown(first, 0, end - 1, less);
+		}
+	}
+
+	template<typename Iterator, typename Less>
+	void introSort(Iterator first, Iterator last, std::ptrdiff_t depth, Less const& less) {
+		while (last - first > insertion_sort_threshold) {
+			if (depth == 0) {
+				heapSort(first, last, less);
+				return;
+			}
+			--depth;
+			moveMedianToFirst(first, first + 1, first + (last - first) / 2, last - 1, less);
+			auto const cut {unguardedPartition(first + 1, last, first, less)};
+			introSort(cut, last, depth, less);
+			last = cut;
+		}
+		insertionSort(first, last, less);
+	}
+
+	/**
+	 * @details
+	 * Merges two sorted adjacent runs through a buffer of rows,\n
+	 * the rows are moved there and back.\n
+	 * */
+	template<typename Iterator, typename Less>
+	void mergeRuns(Iterator first, Iterator middle, Iterator last, Less const& less) {
+		if (!(first < middle) || !(middle < last) || !less(*middle, *(middle - 1))) return;
+
+		std::vector<typename Iterator::value_type> buffer;
+		buffer.reserve(static_cast<std::size_t>(last - first));
+		auto left {first}, right {middle};
+		while (left < middle && right < last) {
+			if (less(*right, *left)) {
+				buffer.emplace_back(iter_move(right));
+				++right;
+			}
+			else {
+				buffer.emplace_back(iter_move(left));
+				++left;
+			}
+		}
+		for (; left < middle; ++left) buffer.emplace_back(iter_move(left));
+		for (; right < last; ++right) buffer.emplace_back(iter_move(right));
+
+		auto out {first};
+		for (auto& row : buffer) {
+			*out = std::move(row);
+			++out;
+		}
+	}
+  }//!namespace
+
+  /**
+   * @details
+   * Sorts the rows of a random access zip (or soa_vector) in place\n
+   * by the Key column, all of the columns are permuted together.\n
+   * It is an introsort, that swaps the rows by the zipped iter_swap\n
+   * and moves them by iter_move, so there is no index vector\n
+   * and no gather afterwards. The sort is not stable.\n
+   * */
+  template<std::size_t Key, typename Range, typename Compare = std::less<>>
+  void sort_by(Range&& zipper, Compare cmp = Compare{}) {
+	  static_assert(base::utils::is_random_access_range_v<Range>, "Sorting requires a random access zip");
+	  using Iterator = std::decay_t<decltype(zipper.begin())>;
+	  using Diff = typename Iterator::difference_type;
+
+	  Iterator const first {zipper.begin()};
+	  auto const n {static_cast<Diff>(zipper.size())};
+	  base::utils::introSort(first, first + n, base::utils::depthLimit(n),
+							 base::utils::KeyCompare<Key, Compare>{std::move(cmp)});
+  }
+
+  /**
+   * @details
+   * Same as sort_by, the range is split into a chunk per thread,\n
+   * those are sorted in parallel by the pool, and then merged\n
+   * pairwise, every round of merges is run in parallel as well.\n
+   * Short ranges are sorted serially.\n
+   * */
+  template<std::size_t Key, typename Range, typename Compare>
+  void parallel_sort_by(Range&& zipper, Compare cmp, thread_pool& pool) {
+	  static_assert(base::utils::is_random_access_range_v<Range>, "Sorting requires a random access zip");
+	  using Iterator = std::decay_t<decltype(zipper.begin())>;
+	  using Diff = typename Iterator::difference_type;
+
+	  auto const total {static_cast<std::size_t>(zipper.size())};
+	  if (total < base::utils::parallel_sort_threshold || pool.size() == 1u) {
+		  sort_by<Key>(std::forward<Range>(zipper), std::move(cmp));
+		  return;
+	  }
+
+	  Iterator const first {zipper.begin()};
+	  base::utils::KeyCompare<Key, Compare> const less {std::move(cmp)};
+	  auto const chunks {pool.size()};
+	  auto bound = [first, total, chunks](std::size_t chunk) {
+		  return first + static_cast<Diff>(chunk * total / chunks);
+	  };
+
+	  auto sort_chunk = [&](std::size_t chunk) {
+		  auto const from {bound(chunk)}, to {bound(chunk + 1)};
+		  base::utils::introSort(from, to, base::utils::depthLimit(to - from), less);
+	  };
+	  pool.run(chunks, sort_chunk);
+
+	  for (std::size_t width = 1; width < chunks; width *= 2) {
+		  auto merge = [&](std::size_t pair) {
+			  auto const lo {pair * 2 * width};
+			  auto const mid {std::min(lo + width, chunks)}, hi {std::min(lo + 2 * width, chunks)};
+			  base::utils::mergeRuns(bound(lo), bound(mid), bound(hi), less);
+		  };
+		  pool.run((chunks + 2 * width - 1) / (2 * width), merge);
+	  }
+  }
+
+  template<std::size_t Key, typename Range, typename Compare = std::less<>>
+  void parallel_sort_by(Range&& zipper, Compare cmp = Compare{}, std::size_t threads = std::thread::hardware_concurrency()) {
+	  if (threads > 1u) {
+		  thread_pool pool (threads);
+		  parallel_sort_by<Key>(std::forward<Range>(zipper), std::move(cmp), pool);
+		  return;
+	  }
+	  sort_by<Key>(std::forward<Range>(zipper), std::move(cmp));
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_SORT_H
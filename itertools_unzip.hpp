@@ -0,0 +1,153 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#ifndef ITERTOOLS_UNZIP_H
+#define ITERTOOLS_UNZIP_H
+
+namespace itertools {
+
+  namespace base::utils {
+	template<typename Container, typename = void>
+	struct MaybeReservable : std::false_type {};
+
+	template<typename Container>
+	struct MaybeReservable<Container, std::void_t<decltype(std::declval<Container&>().reserve(std::size_t{}))>>
+			: std::true_type {};
+
+	template<typename Container, typename Iterator, typename = void>
+	struct MaybeRangeInsertable : std::false_type {};
+
+	template<typename Container, typename Iterator>
+	struct MaybeRangeInsertable<Container, Iterator, std::void_t<decltype(std::declval<Container&>().insert(
+			std::declval<Container&>().end(), std::declval<Iterator>(), std::declval<Iterator>()))>>
+			: std::true_type {};
+
+	template<typename Iterator>
+	struct IsZipIterator : std::false_type {};
+
+	template<typename... Iterators>
+	struct IsZipIterator<ZipIterator<Iterators...>> : std::true_type {};
+
+	template<typename Container>
+	void reserveMore(Container& container, std::size_t count) {
+		if constexpr (MaybeReservable<Container>::value) {
+			container.reserve(container.size() + count);
+		}
+	}
+  }//!namespace
+
+  /**
+   * @details
+   * Output iterator, that splits every row assigned to it\n
+   * into the columns, pushing each element back into its own\n
+   * container, the inverse of zip. The elements of an rvalue\n
+   * row are moved.\n
+   * */
+  template<typename... Containers>
+  class zip_back_insert_iterator {
+  public:
+	  using iterator_category = std::output_iterator_tag;
+	  using value_type = void;
+	  using difference_type = std::ptrdiff_t;
+	  using pointer = void;
+	  using reference = void;
+
+	  explicit
+	  zip_back_insert_iterator(Containers&... containers) : containers (std::addressof(containers)...)
+	  {}
+
+	  template<typename Row>
+	  zip_back_insert_iterator& operator=(Row&& row) {
+		  pushRow(std::forward<Row>(row), std::index_sequence_for<Containers...>{});
+		  return *this;
+	  }
+
+	  zip_back_insert_iterator& operator*() { return *this; }
+	  zip_back_insert_iterator& operator++() { return *this; }
+	  zip_back_insert_iterator operator++(int) { return *this; }
+
+	  /**
+	   * @details
+	   * Makes room for count more rows in every container,\n
+	   * that can be reserved.\n
+	   * */
+	  void reserve(std::size_t count) {
+		  std::apply([count](Containers*... c) { (base::utils::reserveMore(*c, count), ...); }, containers);
+	  }
+
+  private:
+	  std::tuple<Containers*...> containers;
+
+	  template<typename Row, std::size_t... I>
+	  void pushRow(Row&& row, std::index_sequence<I...>) {
+		  static_assert(std::tuple_size_v<std::decay_t<Row>> == sizeof...(Containers), "A row should have an element per container");
+		  (std::get<I>(containers)->push_back(std::get<I>(std::forward<Row>(row))), ...);
+	  }
+  };
+
+  template<typename... Containers>
+  auto zip_back_inserter(Containers&... containers) {
+	  return zip_back_insert_iterator<Containers...>(containers...);
+  }
+
+  namespace base::utils {
+	template<std::size_t Index, typename Iterator, typename Container>
+	void appendColumn(Iterator const& first, std::size_t count, Container& out) {
+		auto const column {first.template base<Index>()};
+		using ColumnIterator = std::decay_t<decltype(column)>;
+		if constexpr (MaybeRangeInsertable<Container, ColumnIterator>::value) {
+			out.insert(out.end(), column, std::next(column, static_cast<std::ptrdiff_t>(count)));
+		}
+		else {
+			auto it {column};
+			for (std::size_t i = 0; i != count; ++i, ++it) out.push_back(*it);
+		}
+	}
+
+	template<typename Iterator, typename... Outs, std::size_t... I>
+	void appendColumns(Iterator const& first, std::size_t count, std::index_sequence<I...>, Outs&... outs) {
+		(appendColumn<I>(first, count, outs), ...);
+	}
+  }//!namespace
+
+  /**
+   * @details
+   * Splits the rows of the range into the containers, one per\n
+   * column. If the range knows its size, every container is\n
+   * reserved once, and a sized zip (or soa_vector) is copied\n
+   * column by column, by a range insert of the underlying\n
+   * iterators, so a contiguous column is copied in bulk.\n
+   * Otherwise, the rows are pushed back one by one.\n
+   * */
+  template<typename Range, typename... Outs>
+  void unzip_into(Range&& range, Outs&... outs) {
+	  using Iterator = std::decay_t<decltype(range.begin())>;
+	  auto inserter {zip_back_inserter(outs...)};
+
+	  if constexpr (culib::requirements::is_sized_v<Range&>) {
+		  auto const count {static_cast<std::size_t>(range.size())};
+		  inserter.reserve(count);
+		  if constexpr (base::utils::IsZipIterator<Iterator>::value) {
+			  static_assert(std::tuple_size_v<Iterator> == sizeof...(Outs), "A row should have an element per container");
+			  base::utils::appendColumns(range.begin(), count, std::index_sequence_for<Outs...>{}, outs...);
+			  return;
+		  }
+	  }
+	  for (auto&& row : range) {
+		  *inserter = std::forward<decltype(row)>(row);
+	  }
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_UNZIP_H
@@ -0,0 +1,212 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include <string>
+#include <system_error>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+#include <cerrno>
+
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define ITERTOOLS_HAS_MMAP
+#endif
+
+#ifndef ITERTOOLS_MMAP_COLUMN_H
+#define ITERTOOLS_MMAP_COLUMN_H
+
+#ifdef ITERTOOLS_HAS_MMAP
+
+namespace itertools {
+
+  enum class mmap_mode { read_only, read_write };
+
+  /**
+   * @details
+   * Access pattern hint, passed to madvise().\n
+   * */
+  enum class mmap_advice { normal, sequential, random };
+
+  /**
+   * @details
+   * Column of trivially copyable Ts, stored in a binary file\n
+   * and mapped into memory, so it is zipped with no load step\n
+   * and no copy on the heap. The pages are read by the kernel\n
+   * on demand, mmap_advice::sequential asks it to read ahead.\n\n
+   * The read only column provides the const pointers only.\n
+   * The read_write one maps the file as shared, so the writes\n
+   * go to the file, sync() flushes them. It either maps an existing\n
+   * file, or creates (truncates) one for the given number of elements.\n\n
+   * POSIX only, the errors of the system calls are thrown as\n
+   * std::system_error.\n
+   * */
+  template<typename T, mmap_mode Mode = mmap_mode::read_only>
+  class mmap_column {
+  private:
+	  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be mapped from a file");
+
+	  static constexpr bool is_writable { Mode == mmap_mode::read_write };
+
+  public:
+	  using value_type = T;
+	  using size_type = std::size_t;
+	  using difference_type = std::ptrdiff_t;
+	  using element_type = std::conditional_t<is_writable, T, T const>;
+	  using pointer = element_type*;
+	  using const_pointer = T const*;
+	  using reference = element_type&;
+	  using const_reference = T const&;
+	  using iterator = pointer;
+	  using const_iterator = const_pointer;
+
+	  explicit
+	  mmap_column(std::string const& path, mmap_advice advice = mmap_advice::normal) {
+		  FileDescriptor file (path, is_writable ? O_RDWR : O_RDONLY, 0);
+		  struct stat info {};
+		  if (::fstat(file.fd, &info) != 0) {
+			  throw std::system_error(errno, std::generic_category(), "mmap_column: fstat " + path);
+		  }
+		  auto const bytes {static_cast<size_type>(info.st_size)};
+		  if (bytes % sizeof(T) != 0u) {
+			  throw std::runtime_error("mmap_column: size of " + path + " is not a multiple of the element size");
+		  }
+		  map(file.fd, bytes / sizeof(T), advice, path);
+	  }
+
+#ifndef __cpp_concepts
+	  template<bool Writable = is_writable, std::enable_if_t<Writable, bool> = true>
+#endif
+	  mmap_column(std::string const& path, size_type count, mmap_advice advice = mmap_advice::normal)
+#ifdef __cpp_concepts
+	  requires is_writable
+#endif
+	  {
+		  FileDescriptor file (path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+		  if (::ftruncate(file.fd, static_cast<off_t>(count * sizeof(T))) != 0) {
+			  throw std::system_error(errno, std::generic_category(), "mmap_column: ftruncate " + path);
+		  }
+		  map(file.fd, count, advice, path);
+	  }
+
+	  mmap_column(mmap_column const&) = delete;
+	  mmap_column& operator = (mmap_column const&) = delete;
+
+	  mmap_column(mmap_column&& other) noexcept
+			  : first (std::exchange(other.first, nullptr))
+			  , size_ (std::exchange(other.size_, 0u))
+	  {}
+
+	  mmap_column& operator = (mmap_column&& other) noexcept {
+		  if (this != &other) {
+			  unmap();
+			  first = std::exchange(other.first, nullptr);
+			  size_ = std::exchange(other.size_, 0u);
+		  }
+		  return *this;
+	  }
+
+	  ~mmap_column() { unmap(); }
+
+	  size_type size() const { return size_; }
+	  bool empty() const { return size_ == 0u; }
+
+	  pointer data() { return first; }
+	  const_pointer data() const { return first; }
+
+	  iterator begin() { return first; }
+	  iterator end() { return first + size_; }
+	  const_iterator begin() const { return first; }
+	  const_iterator end() const { return first + size_; }
+	  const_iterator cbegin() const { return first; }
+	  const_iterator cend() const { return first + size_; }
+
+	  reference operator[](size_type index) { return first[index]; }
+	  const_reference operator[](size_type index) const { return first[index]; }
+
+	  /**
+	   * @details
+	   * Flushes the written pages to the file.\n
+	   * */
+#ifndef __cpp_concepts
+	  template<bool Writable = is_writable, std::enable_if_t<Writable, bool> = true>
+#endif
+	  void sync()
+#ifdef __cpp_concepts
+	  requires is_writable
+#endif
+	  {
+		  if (size_ != 0u && ::msync(mapping(), size_ * sizeof(T), MS_SYNC) != 0) {
+			  throw std::system_error(errno, std::generic_category(), "mmap_column: msync");
+		  }
+	  }
+
+  private:
+	  pointer first {nullptr};
+	  size_type size_ {0u};
+
+	  /**
+	   * @details
+	   * The descriptor is not needed once the file is mapped.\n
+	   * */
+	  struct FileDescriptor {
+		  int fd;
+
+		  FileDescriptor(std::string const& path, int flags, mode_t permissions)
+				  : fd (::open(path.c_str(), flags | O_CLOEXEC, permissions))
+		  {
+			  if (fd < 0) {
+				  throw std::system_error(errno, std::generic_category(), "mmap_column: open " + path);
+			  }
+		  }
+		  FileDescriptor(FileDescriptor const&) = delete;
+		  FileDescriptor& operator = (FileDescriptor const&) = delete;
+		  ~FileDescriptor() { ::close(fd); }
+	  };
+
+	  void* mapping() const {
+		  return const_cast<void*>(static_cast<void const*>(first));
+	  }
+
+	  /**
+	   * @details
+	   * An empty file can't be mapped, so it is just an empty column.\n
+	   * */
+	  void map(int fd, size_type count, mmap_advice advice, std::string const& path) {
+		  if (count == 0u) return;
+		  auto const bytes {count * sizeof(T)};
+		  void* address {::mmap(nullptr, bytes, is_writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0)};
+		  if (address == MAP_FAILED) {
+			  throw std::system_error(errno, std::generic_category(), "mmap_column: mmap " + path);
+		  }
+		  first = static_cast<pointer>(address);
+		  size_ = count;
+		  if (advice != mmap_advice::normal) {
+			  // just a hint, a failure is not an error
+			  ::madvise(address, bytes, advice == mmap_advice::sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+		  }
+	  }
+
+	  void unmap() {
+		  if (first != nullptr) {
+			  ::munmap(mapping(), size_ * sizeof(T));
+			  first = nullptr;
+			  size_ = 0u;
+		  }
+	  }
+  };
+
+  template<typename T>
+  using mmap_output_column = mmap_column<T, mmap_mode::read_write>;
+
+}//!namespace
+
+#endif //ITERTOOLS_HAS_MMAP
+
+#endif //ITERTOOLS_MMAP_COLUMN_H
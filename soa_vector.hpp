@@ -0,0 +1,292 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#pragma once
+
+#include "itertools.hpp"
+
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <stdexcept>
+
+#ifndef ITERTOOLS_SOA_VECTOR_H
+#define ITERTOOLS_SOA_VECTOR_H
+
+namespace itertools {
+
+  /**
+   * @details
+   * Structure of arrays container - each of the Ts is stored\n
+   * in its own contiguous column, while size and capacity are\n
+   * shared, so all of the columns grow at the same step.\n\n
+   * Iterators are the ZipIterators over the raw column pointers,\n
+   * so the container is used in a range-based for loop with\n
+   * the structured bindings, same as zip(...) is.\n
+   * */
+  template<typename... Ts>
+  class soa_vector {
+  private:
+	  static_assert(sizeof...(Ts) > 0u, "At least one column is required");
+
+	  using Indices = std::index_sequence_for<Ts...>;
+
+  public:
+	  using value_type = std::tuple<Ts...>;
+	  using size_type = std::size_t;
+	  using difference_type = std::ptrdiff_t;
+	  using iterator = ZipIterator<Ts*...>;
+	  using const_iterator = ZipIterator<Ts const*...>;
+	  using reference = typename iterator::reference;
+	  using const_reference = typename const_iterator::reference;
+
+	  soa_vector() = default;
+
+	  explicit
+	  soa_vector(size_type count) {
+		  resize(count);
+	  }
+
+	  soa_vector(soa_vector const& other) {
+		  reserve(other.size_);
+		  for (auto const& row : other) {
+			  std::apply([this](Ts const&... values){ emplace_back(values...); }, row);
+		  }
+	  }
+
+	  soa_vector(soa_vector&& other) noexcept
+			  : columns (std::exchange(other.columns, std::tuple<Ts*...>{}))
+			  , size_ (std::exchange(other.size_, 0u))
+			  , capacity_ (std::exchange(other.capacity_, 0u))
+	  {}
+
+	  soa_vector& operator = (soa_vector const& other) {
+		  if (this != &other) {
+			  soa_vector tmp (other);
+			  swap(tmp);
+		  }
+		  return *this;
+	  }
+
+	  soa_vector& operator = (soa_vector&& other) noexcept {
+		  soa_vector tmp (std::move(other));
+		  swap(tmp);
+		  return *this;
+	  }
+
+	  ~soa_vector() {
+		  clear();
+		  deallocate(columns, capacity_, Indices{});
+	  }
+
+	  void swap(soa_vector& other) noexcept {
+		  std::swap(columns, other.columns);
+		  std::swap(size_, other.size_);
+		  std::swap(capacity_, other.capacity_);
+	  }
+
+	  size_type size() const { return size_; }
+	  size_type capacity() const { return capacity_; }
+	  bool empty() const { return size_ == 0u; }
+
+	  /**
+	   * @details
+	   * Raw pointer to the column Index.\n
+	   * */
+	  template<std::size_t Index>
+	  auto* data() { return std::get<Index>(columns); }
+	  template<std::size_t Index>
+	  auto const* data() const { return std::get<Index>(columns); }
+
+	  iterator begin() { return makeIterator<iterator>(0u, Indices{}); }
+	  iterator end() { return makeIterator<iterator>(size_, Indices{}); }
+	  const_iterator begin() const { return makeIterator<const_iterator>(0u, Indices{}); }
+	  const_iterator end() const { return makeIterator<const_iterator>(size_, Indices{}); }
+	  const_iterator cbegin() const { return begin(); }
+	  const_iterator cend() const { return end(); }
+
+	  reference operator[](size_type index) { return *makeIterator<iterator>(index, Indices{}); }
+	  const_reference operator[](size_type index) const { return *makeIterator<const_iterator>(index, Indices{}); }
+
+	  reference at(size_type index) {
+		  if (index >= size_) throw std::out_of_range("soa_vector index is out of range");
+		  return operator[](index);
+	  }
+	  const_reference at(size_type index) const {
+		  if (index >= size_) throw std::out_of_range("soa_vector index is out of range");
+		  return operator[](index);
+	  }
+
+	  /**
+	   * @details
+	   * One growth step for all of the columns.\n
+	   * */
+	  void reserve(size_type new_capacity) {
+		  if (new_capacity > capacity_) {
+			  reallocate(new_capacity, Indices{});
+		  }
+	  }
+
+	  /**
+	   * @details
+	   * Each of the arguments constructs an element of its own column.\n
+	   * */
+	  template<typename... Args>
+	  reference emplace_back(Args&&... args) {
+		  static_assert(sizeof...(Args) == sizeof...(Ts), "One argument per column is required");
+		  if (size_ == capacity_) {
+			  reallocate(grownCapacity(), Indices{}, std::forward<Args>(args)...);
+		  }
+		  else {
+			  constructAt(columns, size_, Indices{}, std::forward<Args>(args)...);
+		  }
+		  ++size_;
+		  return operator[](size_ - 1u);
+	  }
+
+	  void push_back(Ts const&... values) { emplace_back(values...); }
+	  void push_back(Ts&&... values) { emplace_back(std::move(values)...); }
+	  void push_back(value_type const& values) {
+		  std::apply([this](Ts const&... v){ emplace_back(v...); }, values);
+	  }
+	  void push_back(value_type&& values) {
+		  std::apply([this](Ts&... v){ emplace_back(std::move(v)...); }, values);
+	  }
+
+	  void pop_back() {
+		  --size_;
+		  destroyAt(columns, size_, Indices{});
+	  }
+
+	  void resize(size_type count) {
+		  while (size_ > count) pop_back();
+		  reserve(count);
+		  while (size_ < count) emplace_back(Ts{}...);
+	  }
+
+	  void clear() {
+		  while (size_ != 0u) pop_back();
+	  }
+
+  private:
+	  std::tuple<Ts*...> columns {};
+	  size_type size_ {0u};
+	  size_type capacity_ {0u};
+
+	  size_type grownCapacity() const {
+		  return capacity_ == 0u ? 1u : 2u * capacity_;
+	  }
+
+	  template<typename Iterator, std::size_t... I>
+	  Iterator makeIterator(size_type offset, std::index_sequence<I...>) const {
+		  return Iterator ((std::get<I>(columns) + offset)...);
+	  }
+
+	  template<std::size_t... I, typename... Args>
+	  static void constructAt(std::tuple<Ts*...>& target, size_type index, std::index_sequence<I...>, Args&&... args) {
+		  std::size_t constructed {0u};
+		  try {
+			  ((::new (static_cast<void*>(std::get<I>(target) + index)) Ts(std::forward<Args>(args)), ++constructed), ...);
+		  }
+		  catch (...) {
+			  ((I < constructed ? std::destroy_at(std::get<I>(target) + index) : void()), ...);
+			  throw;
+		  }
+	  }
+
+	  template<std::size_t... I>
+	  static void destroyAt(std::tuple<Ts*...>& target, size_type index, std::index_sequence<I...>) {
+		  (std::destroy_at(std::get<I>(target) + index), ...);
+	  }
+
+	  template<std::size_t... I>
+	  static std::tuple<Ts*...> allocate(size_type count, std::index_sequence<I...>) {
+		  std::tuple<Ts*...> result {};
+		  try {
+			  ((std::get<I>(result) = std::allocator<Ts>{}.allocate(count)), ...);
+		  }
+		  catch (...) {
+			  deallocate(result, count, std::index_sequence<I...>{});
+			  throw;
+		  }
+		  return result;
+	  }
+
+	  template<std::size_t... I>
+	  static void deallocate(std::tuple<Ts*...>& target, size_type count, std::index_sequence<I...>) {
+		  ((std::get<I>(target) ? std::allocator<Ts>{}.deallocate(std::get<I>(target), count) : void()), ...);
+	  }
+
+	  /**
+	   * @details
+	   * Builds the copy of a column, moving the elements if that\n
+	   * can't throw, the elements built are destroyed on a throw.\n
+	   * The old column is left as is.\n
+	   * */
+	  template<typename T>
+	  static void relocate(T* from, T* to, size_type count) {
+		  size_type built {0u};
+		  try {
+			  for (; built != count; ++built) {
+				  ::new (static_cast<void*>(to + built)) T(std::move_if_noexcept(from[built]));
+			  }
+		  }
+		  catch (...) {
+			  std::destroy(to, to + built);
+			  throw;
+		  }
+	  }
+
+	  /**
+	   * @details
+	   * All of the new columns are allocated first, then the new element,\n
+	   * if any, is constructed - that is safe even if the arguments refer\n
+	   * to the elements of this very container, and then the existing\n
+	   * elements are relocated. The old columns are destroyed only\n
+	   * when all of the new ones are built, a throw rolls back what\n
+	   * was built, so the container is left unchanged, as std::vector is\n
+	   * (unless a column is not copyable and its move throws).\n
+	   * */
+	  template<std::size_t... I, typename... Args>
+	  void reallocate(size_type new_capacity, std::index_sequence<I...>, Args&&... args) {
+		  auto fresh {allocate(new_capacity, std::index_sequence<I...>{})};
+		  if constexpr (sizeof...(Args) != 0u) {
+			  try {
+				  constructAt(fresh, size_, std::index_sequence<I...>{}, std::forward<Args>(args)...);
+			  }
+			  catch (...) {
+				  deallocate(fresh, new_capacity, std::index_sequence<I...>{});
+				  throw;
+			  }
+		  }
+		  // the columns, that may throw, are copied first, the moves that can't throw go last,
+		  // so a throw leaves all of the old columns intact
+		  bool built[sizeof...(I)] {};
+		  try {
+			  ((std::is_nothrow_move_constructible_v<Ts> ? void()
+					  : (relocate(std::get<I>(columns), std::get<I>(fresh), size_), void(built[I] = true))), ...);
+		  }
+		  catch (...) {
+			  ((built[I] ? std::destroy(std::get<I>(fresh), std::get<I>(fresh) + size_) : void()), ...);
+			  if constexpr (sizeof...(Args) != 0u) destroyAt(fresh, size_, std::index_sequence<I...>{});
+			  deallocate(fresh, new_capacity, std::index_sequence<I...>{});
+			  throw;
+		  }
+		  ((std::is_nothrow_move_constructible_v<Ts> ? relocate(std::get<I>(columns), std::get<I>(fresh), size_) : void()), ...);
+		  (std::destroy(std::get<I>(columns), std::get<I>(columns) + size_), ...);
+		  deallocate(columns, capacity_, std::index_sequence<I...>{});
+		  columns = fresh;
+		  capacity_ = new_capacity;
+	  }
+  };
+
+  template<typename... Ts>
+  void swap(soa_vector<Ts...>& lhs, soa_vector<Ts...>& rhs) noexcept {
+	  lhs.swap(rhs);
+  }
+
+}//!namespace
+
+#endif //ITERTOOLS_SOA_VECTOR_H
@@ -4,12 +4,31 @@
 
 #include <gtest/gtest.h>
 
+#define ITERTOOLS_STATS
+
 #include "itertools.hpp"
+#include "itertools_parallel.hpp"
+#include "soa_vector.hpp"
+#include "itertools_sort.hpp"
+#include "mmap_column.hpp"
+#include "itertools_buffered.hpp"
+#include "itertools_pipeline.hpp"
+#include "itertools_unzip.hpp"
+#include "itertools_numeric.hpp"
+#include "itertools_product.hpp"
+#include "itertools_join.hpp"
+#include "itertools_generator.hpp"
 #include <vector>
 #include <map>
 #include <unordered_map>
+#include <list>
 #include <string>
 #include <sstream>
+#include <numeric>
+#include <array>
+#include <fstream>
+#include <filesystem>
+#include <thread>
 
 
 //#define WRONG_ITERATOR_COMPILE_FAILURE
@@ -202,12 +221,56 @@ TEST(BasicsItertools, MoveIteratorsCheck) {
 	auto begin = itertools::zip(std::make_move_iterator(v1.begin()), std::make_move_iterator(s1.begin()));
 	auto &&[i, c] = std::move(begin);
 
-//	ASSERT_TRUE(v1.at(0).empty()); //todo: fix required
+	ASSERT_TRUE(v1.at(0).empty());
 	ASSERT_EQ(i, v1_at_0_copy);
 
-//	ASSERT_TRUE(s1.at(0).empty()); //todo: fix required
+	ASSERT_TRUE(s1.at(0).empty());
 	ASSERT_EQ(c, s1_at_0_copy);
 }
+namespace {
+  struct CopyCounter {
+	  static inline int copies {0};
+	  std::string payload;
+
+	  explicit CopyCounter(std::string payload) : payload (std::move(payload)) {}
+	  CopyCounter(CopyCounter const& other) : payload (other.payload) { ++copies; }
+	  CopyCounter(CopyCounter&& other) noexcept = default;
+	  CopyCounter& operator = (CopyCounter const& other) { payload = other.payload; ++copies; return *this; }
+	  CopyCounter& operator = (CopyCounter&& other) noexcept = default;
+  };
+}
+TEST(BasicsItertools, MoveIteratorsNoCopies) {
+	std::vector<CopyCounter> names, values;
+	for (int i = 0; i != 3; ++i) {
+		names.emplace_back("name_" + std::to_string(i) + "_long_enough_not_to_be_small");
+		values.emplace_back("value_" + std::to_string(i) + "_long_enough_not_to_be_small");
+	}
+	CopyCounter::copies = 0;
+
+	auto it = itertools::zip(std::make_move_iterator(names.begin()), std::make_move_iterator(values.begin()));
+	auto const end = itertools::zip(std::make_move_iterator(names.end()), std::make_move_iterator(values.end()));
+	static_assert(std::is_same_v<std::tuple_element_t<0, decltype(it)>, CopyCounter&&>);
+	static_assert(std::is_same_v<decltype(*it), itertools::zip_reference<CopyCounter&&, CopyCounter&&>>);
+
+	std::vector<CopyCounter> moved_names, moved_values;
+	for (; it != end; ++it) {
+		auto&& [name, value] = *it;
+		moved_names.push_back(std::forward<decltype(name)>(name));
+		moved_values.push_back(std::forward<decltype(value)>(value));
+	}
+	ASSERT_EQ(CopyCounter::copies, 0);
+	ASSERT_EQ(moved_names.back().payload, "name_2_long_enough_not_to_be_small");
+	ASSERT_TRUE(names.back().payload.empty());
+
+	auto owning = itertools::zip(std::make_move_iterator(moved_names.begin()), std::make_move_iterator(moved_values.begin()));
+	decltype(owning)::value_type row = *owning;
+	auto&& [name, value] = std::move(++owning);
+	ASSERT_EQ(CopyCounter::copies, 0);
+	ASSERT_EQ(std::get<0>(row).payload, "name_0_long_enough_not_to_be_small");
+	ASSERT_EQ(value.payload, "value_1_long_enough_not_to_be_small");
+	ASSERT_TRUE(moved_names[1].payload.empty());
+	ASSERT_EQ(name.payload, "name_1_long_enough_not_to_be_small");
+}
 TEST(BasicsItertools, Failure_NonContainers) {
 	struct NotOkContainer { int value {42}; };
 	[[maybe_unused]] NotOkContainer not_ok;
@@ -345,9 +408,1025 @@ TEST(BasicsItertools, Failure_OperatorMinusForNonBidirectional) {
 	it = it - 1; //fails to compile
 #endif
 }
+TEST(SizedItertools, MinimalLength) {
+	using namespace std::string_literals;
+	std::vector<int> v{ 1,2,3,4,5 };
+	std::map<int, std::string> m { {1, "one"s}, {2, "two"s}, {3, "three"s} };
+	std::string s { "abcdefghhlk" };
+
+	auto zipper = itertools::zip(v, m, s);
+	static_assert(decltype(zipper)::is_sized);
+	ASSERT_EQ(zipper.size(), 3u);
+
+	std::size_t count {0u};
+	for (auto const& [i, pair, ch] : zipper) {
+		ASSERT_EQ(i, pair.first);
+		ASSERT_EQ(ch, 'a' + i - 1);
+		++count;
+	}
+	ASSERT_EQ(count, zipper.size());
+}
+TEST(SizedItertools, NonRandomAccessLead) {
+	std::list<int> l{ 1,2,3,4 };
+	std::map<int, int> m { {1, 10}, {2, 20}, {3, 30} };
+
+	auto zipper = itertools::zip(l, m);
+	static_assert(decltype(zipper)::lead == 0u);
+	ASSERT_EQ(zipper.size(), 3u);
+
+	std::stringstream ss;
+	for (auto const& [i, pair] : zipper) {
+		ss << i << ' ' << pair.second << '\n';
+	}
+	std::string check {R"(1 10
+2 20
+3 30
+)"};
+	ASSERT_EQ(ss.str(), check);
+}
+TEST(SizedItertools, UnsizedFallback) {
+	struct NoSize {
+		std::list<int> l { 1,2,3 };
+		using iterator = std::list<int>::iterator;
+		using const_iterator = std::list<int>::const_iterator;
+		auto begin() { return l.begin(); }
+		auto end() { return l.end(); }
+	};
+	NoSize no_size;
+	std::vector<int> v{ 1,2,3,4,5 };
+
+	auto zipper = itertools::zip(v, no_size);
+	static_assert(!decltype(zipper)::is_sized);
+
+	int sum {0};
+	for (auto const& [i, j] : zipper) {
+		sum += i * j;
+	}
+	ASSERT_EQ(sum, 1 + 4 + 9);
+}
+TEST(SentinelItertools, HalfSizedRange) {
+	std::vector<int> v{ 1,2,3 };
+	std::list<int> l{ 1,2,3,4 };
+	std::map<int, int> m { {1, 10}, {2, 20}, {3, 30} };
+
+	auto zipper = itertools::zip(v, l, m);
+	using Zipper = decltype(zipper);
+	static_assert(sizeof(Zipper::sentinel_type) == sizeof(std::vector<int>::iterator));
+	static_assert(sizeof(Zipper) < 2 * sizeof(Zipper::zip_type));
+
+	auto it = zipper.begin();
+	auto const end = zipper.end();
+	ASSERT_TRUE(it != end);
+	ASSERT_FALSE(end == it);
+	it += 3;
+	ASSERT_TRUE(it == end);
+	ASSERT_FALSE(end != it);
+}
+TEST(SentinelItertools, StrictEqualLengths) {
+	std::vector<int> v{ 1,2,3 };
+	std::list<char> l{ 'a','b','c' };
+	std::map<int, int> m { {1, 10}, {2, 20} };
+
+	auto zipper = itertools::zip_strict(v, l, std::string("xyz"));
+	using Zipper = decltype(zipper);
+	static_assert(std::is_same_v<Zipper::sentinel_type, itertools::zip_sentinel<Zipper::zip_type, Zipper::lead>>);
+
+	std::stringstream ss;
+	for (auto const& [i, c, s] : zipper) {
+		ss << i << c << s << ' ';
+	}
+	ASSERT_EQ(ss.str(), "1ax 2by 3cz ");
+
+	ASSERT_THROW(itertools::zip_strict(v, m), std::length_error);
+	ASSERT_THROW(itertools::zip_strict(std::vector<int>{}, l), std::length_error);
+	ASSERT_NO_THROW(itertools::zip_strict(std::vector<int>{}, std::string{}));
+}
+TEST(SentinelItertools, UnsizedTracksAllEnds) {
+	struct NoSize {
+		std::list<int> l { 1,2,3 };
+		using iterator = std::list<int>::iterator;
+		using const_iterator = std::list<int>::const_iterator;
+		auto begin() { return l.begin(); }
+		auto end() { return l.end(); }
+	};
+	NoSize no_size;
+	std::map<int, int> m { {1, 10}, {2, 20} };
+
+	auto zipper = itertools::zip(no_size, m);
+	using Zipper = decltype(zipper);
+	static_assert(sizeof(Zipper::sentinel_type) == sizeof(Zipper::zip_type));
+
+	int count {0};
+	for (auto it = zipper.begin(); it != zipper.end(); ++it) {
+		++count;
+	}
+	ASSERT_EQ(count, 2);
+}
+TEST(OwningItertools, TemporaryContainers) {
+	auto make_vector = [] { return std::vector<int>{ 1,2,3,4 }; };
+	std::string s { "abc" };
+
+	auto zipper = itertools::zip(make_vector(), s);
+	static_assert(std::is_same_v<decltype(zipper), itertools::Zipper<std::vector<int>, std::string&>>);
+	static_assert(sizeof(itertools::Zipper<std::vector<int>&, std::string&>) <
+			sizeof(itertools::Zipper<std::vector<int>, std::string&>));
+
+	std::stringstream ss;
+	for (auto const& [i, c] : zipper) {
+		ss << i << c << ' ';
+	}
+	for (auto&& [i, c] : itertools::zip(make_vector(), std::array<char, 2>{ 'x', 'y' })) {
+		ss << i << c << ' ';
+	}
+	ASSERT_EQ(ss.str(), "1a 2b 3c 1x 2y ");
+}
+TEST(OwningItertools, MovedZipperKeepsPositions) {
+	std::vector<int> v{ 1,2,3,4,5 };
+	auto zipper = itertools::zip(v, std::string("abcd"), std::list<int>{ 10,20,30,40 });
+	++zipper.begin();
+
+	auto moved = std::move(zipper);
+	auto copied = moved;
+
+	std::stringstream ss;
+	for (auto const& [i, c, l] : moved) {
+		ss << i << c << l << ' ';
+	}
+	for (auto const& [i, c, l] : copied) {
+		ss << i << c << l << ' ';
+	}
+	ASSERT_EQ(ss.str(), "2b20 3c30 4d40 2b20 3c30 4d40 ");
+}
+TEST(RangesItertools, RandomAccessOperations) {
+	std::vector<int> v{ 1,2,3,4,5 };
+	std::string s { "abcd" };
+
+	auto zipper = itertools::zip(v, s);
+	auto first = zipper.begin();
+	auto third = 2 + first;
+	ASSERT_EQ(third - first, 2);
+	ASSERT_EQ(zipper.end() - first, 4);
+	ASSERT_TRUE(first < third);
+	ASSERT_TRUE(third >= first);
+	ASSERT_EQ(std::get<1>(first[3]), 'd');
+
+	auto row = iter_move(third);
+	static_assert(std::is_same_v<decltype(row), itertools::zip_reference<int&&, char&&>>);
+	iter_swap(first, third);
+	ASSERT_EQ(v[0], 3);
+	ASSERT_EQ(s, "cbad");
+}
+#ifdef __cpp_concepts
+TEST(RangesItertools, StandardAlgorithms) {
+	std::vector<int> keys{ 5,3,1,4,2 };
+	std::vector<std::string> names{ "five", "three", "one", "four", "two" };
+
+	auto zipper = itertools::zip(keys, names);
+	using Zipper = decltype(zipper);
+	static_assert(std::random_access_iterator<Zipper::zip_type>);
+	static_assert(std::ranges::random_access_range<Zipper>);
+	static_assert(std::ranges::sized_range<Zipper>);
+	static_assert(std::ranges::view<Zipper>);
+	static_assert(std::ranges::borrowed_range<Zipper>);
+	static_assert(!std::ranges::borrowed_range<itertools::Zipper<std::vector<int>, std::string&>>);
+	static_assert(!std::ranges::random_access_range<itertools::Zipper<std::vector<int>&, std::list<int>&>>);
+
+	std::ranges::sort(zipper, {}, [](auto const& row) { return std::get<0>(row); });
+	ASSERT_EQ(keys, (std::vector<int>{ 1,2,3,4,5 }));
+	ASSERT_EQ(names, (std::vector<std::string>{ "one", "two", "three", "four", "five" }));
+
+	ASSERT_EQ(std::ranges::distance(zipper), 5);
+	auto found = std::ranges::lower_bound(zipper, 4, {}, [](auto const& row) { return std::get<0>(row); });
+	ASSERT_EQ(std::get<1>(*found), "four");
+
+	std::stringstream ss;
+	for (auto const& [key, name] : zipper | std::views::reverse | std::views::take(2)) {
+		ss << key << name << ' ';
+	}
+	ASSERT_EQ(ss.str(), "5five 4four ");
+}
+#endif
+namespace {
+	template<typename Zip, typename = void>
+	struct HasStride : std::false_type {};
+	template<typename Zip>
+	struct HasStride<Zip, std::void_t<decltype(std::declval<Zip>().stride(2u))>> : std::true_type {};
+
+	template<typename Zip, typename = void>
+	struct HasSlice : std::false_type {};
+	template<typename Zip>
+	struct HasSlice<Zip, std::void_t<decltype(std::declval<Zip>().slice(0u, 2u))>> : std::true_type {};
+}
+TEST(RangesItertools, StrideAndSlice) {
+	std::vector<int> v {0, 1, 2, 3, 4, 5, 6};
+	std::string s {"abcdefg"};
+	auto zipper {itertools::zip(v, s)};
+
+	std::stringstream ss;
+	for (auto const& [i, c] : zipper.stride(3)) {
+		ss << i << c << ' ';
+	}
+	ASSERT_EQ(ss.str(), "0a 3d 6g ");
+	ASSERT_EQ(zipper.stride(2).size(), 4u);
+	ASSERT_EQ(zipper.stride(7).size(), 1u);
+	ASSERT_EQ(zipper.stride(std::numeric_limits<std::size_t>::max()).size(), 1u);
+	ASSERT_EQ(std::get<1>(*zipper.stride(std::numeric_limits<std::size_t>::max()).begin()), 'a');
+	std::vector<int> none;
+	ASSERT_EQ(itertools::zip(none, none).stride(std::numeric_limits<std::size_t>::max()).size(), 0u);
+	ASSERT_THROW(zipper.stride(0), std::invalid_argument);
+
+	// the rows of a temporary zip, that owns a container, would dangle
+	using Owning = decltype(itertools::zip(std::vector<int>{}, s));
+	static_assert(!HasStride<Owning>::value && !HasSlice<Owning>::value);
+	static_assert(HasStride<Owning&>::value && HasSlice<Owning const&>::value);
+	static_assert(HasStride<decltype(zipper)>::value && HasSlice<decltype(zipper)>::value);
+
+	auto strided {zipper.stride(2)};
+	auto it {strided.begin()};
+	it += 2;
+	ASSERT_EQ(std::get<1>(*it), 'e');
+	ASSERT_EQ(std::get<0>(it[1]), 6);
+	ASSERT_EQ(strided.end() - it, 2);
+
+	for (auto&& [i, c] : zipper.slice(2, 5)) {
+		i = -i;
+		c = 'z';
+	}
+	ASSERT_EQ(v, (std::vector<int>{0, 1, -2, -3, -4, 5, 6}));
+	ASSERT_EQ(s, "abzzzfg");
+	ASSERT_EQ(zipper.slice(5, 100).size(), 2u);
+	ASSERT_EQ(zipper.slice(9, 3).size(), 0u);
+
+	std::list<int> l {1, 2, 3};
+	auto const long_step {static_cast<std::ptrdiff_t>(std::numeric_limits<int>::max()) + 10};
+	auto list_it {itertools::zip(v, l).begin()};
+	static_assert(std::is_same_v<decltype(list_it + long_step), decltype(list_it)>);
+}
+TEST(IndexedItertools, ContiguousSharedIndex) {
+	int ints[] { 1,2,3,4,5 };
+	double doubles[] { .5, 1.5, 2.5, 3.5 };
+	char chars[] { 'a', 'b', 'c', 'd', 'e', 'f' };
+
+	using Zip = itertools::ZipIterator<int*, double*, char*>;
+	static_assert(sizeof(Zip) == 3 * sizeof(void*) + sizeof(std::ptrdiff_t));
+#ifdef __cpp_concepts
+	static_assert(sizeof(itertools::ZipIterator<std::vector<int>::iterator, std::string::iterator>) ==
+			2 * sizeof(void*) + sizeof(std::ptrdiff_t));
+#endif
+
+	auto it = itertools::zip(std::begin(ints), std::begin(doubles), std::begin(chars));
+	auto const end = itertools::zip(std::end(ints), std::end(doubles), std::end(chars));
+	std::stringstream ss;
+	for (; it != end; ++it) {
+		auto const& [i, d, c] = *it;
+		ss << i << d << c << ' ';
+	}
+	ASSERT_EQ(ss.str(), "10.5a 21.5b 32.5c 43.5d ");
+	ASSERT_EQ(std::get<0>(*--it), 4);
+	it -= 3;
+	ASSERT_EQ(std::get<2>(*it), 'a');
+	ASSERT_EQ(std::get<1>(it[2]), 2.5);
+	ASSERT_EQ(it.base<1>(), std::begin(doubles));
+
+	itertools::soa_vector<int, char> soa;
+	soa.push_back(1, 'x');
+	soa.push_back(2, 'y');
+	int sum {0};
+	for (auto const& [i, c] : soa) sum += i + (c - 'x');
+	ASSERT_EQ(sum, 4);
+}
+TEST(ParallelItertools, ForEach_RandomAccess) {
+	std::size_t const n {100'003u};
+	std::vector<int> a (n), b (n), c (n, 0);
+	std::iota(a.begin(), a.end(), 0);
+	std::iota(b.begin(), b.end(), 1);
+
+	itertools::parallel_for_each(itertools::zip(a, b, c), [](auto&& row) {
+		auto& [x, y, z] = row;
+		z = x + y;
+	}, 4u);
+
+	for (std::size_t i = 0; i != n; ++i) {
+		ASSERT_EQ(c[i], static_cast<int>(2 * i + 1));
+	}
+}
+TEST(ParallelItertools, ForEach_PoolReuse) {
+	itertools::thread_pool pool (3u);
+	ASSERT_EQ(pool.size(), 3u);
+
+	std::vector<long> v (1000u, 1);
+	std::string s (999u, 'x');
+	for (int round = 0; round != 10; ++round) {
+		itertools::parallel_for_each(itertools::zip(v, s), [](auto&& row) {
+			auto& [i, ch] = row;
+			i += ch == 'x' ? 1 : 0;
+		}, pool);
+	}
+	ASSERT_EQ(std::accumulate(v.begin(), v.end(), 0l), 999 * 11 + 1);
+}
+TEST(ParallelItertools, ForEach_NestedRunInline) {
+	itertools::thread_pool pool (3u);
+	std::vector<std::vector<int>> rows (8u, std::vector<int>(100u, 1));
+	std::vector<int> sums (rows.size());
+	itertools::parallel_for_each(itertools::zip(rows, sums), [&pool](auto&& row) {
+		auto& [values, sum] = row;
+		std::atomic<int> total {0};
+		itertools::parallel_for_each(itertools::zip(values), [&total](auto const& value) {
+			total += std::get<0>(value);
+		}, pool);
+		sum = total.load();
+	}, pool);
+	ASSERT_EQ(sums, std::vector<int>(rows.size(), 100));
+}
+TEST(ParallelItertools, ForEach_ForwardFallback) {
+	std::vector<int> v{ 1,2,3 };
+	std::unordered_map<int, int> m{ {1, 2}, {2, 3}, {3, 4} };
+
+	int sum {0};
+	itertools::parallel_for_each(itertools::zip(v, m), [&sum](auto&& row) {
+		auto const& [i, pair] = row;
+		sum += i + pair.first;
+	}, 4u);
+	ASSERT_EQ(sum, 12);
+}
+TEST(ParallelItertools, ForEach_Exception) {
+	std::vector<int> v (1000u, 0);
+	auto throwing = [](auto&& row) {
+		auto const& [i] = row;
+		if (i == 0) throw std::runtime_error("failure");
+	};
+	ASSERT_THROW(itertools::parallel_for_each(itertools::zip(v), throwing, 4u), std::runtime_error);
+}
+TEST(StatsItertools, HotPathCounters) {
+	std::vector<int> v {1, 2, 3, 4};
+	std::list<char> l {'a', 'b', 'c', 'd', 'e'};
+	itertools::stats() = {};
+
+	int sum {0};
+	for (auto const& [i, c] : itertools::zip(v, l)) {
+		sum += i + c;
+	}
+	auto const& counters {itertools::stats()};
+	ASSERT_EQ(counters.increments, 4u);
+	ASSERT_EQ(counters.comparisons, 5u);
+	ASSERT_EQ(counters.dereferences, 4u);
+	ASSERT_EQ(counters.stepped, 0u);
+
+	auto it {itertools::zip(v, l).begin()};
+	it += 3;
+	ASSERT_EQ(counters.advances, 1u);
+	ASSERT_EQ(counters.stepped, 3u);
+	auto&& [i, c] = it;
+	ASSERT_EQ(i + c, 4 + 'd');
+	ASSERT_EQ(counters.gets, 2u);
+	ASSERT_EQ(counters.increments, 7u);
+
+	it -= 2;
+	ASSERT_EQ(counters.stepped, 5u);
+	ASSERT_EQ(counters.decrements, 2u);
+	ASSERT_EQ(std::get<1>(*it), 'b');
+	it += -2;
+	ASSERT_EQ(counters.stepped, 5u);
+	ASSERT_EQ(counters.increments, 7u);
+
+	std::thread([] { ASSERT_EQ(itertools::stats().increments, 0u); }).join();
+}
+TEST(PipelineItertools, FilterTransformTakeDrop) {
+	using namespace itertools;
+	std::vector<int> v {1, 2, 3, 4, 5, 6, 7, 8};
+	std::list<char> l {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+
+	auto is_even = [](auto const& row) { return std::get<0>(row) % 2 == 0; };
+	auto to_string = [](auto const& row) { return std::string(1, std::get<1>(row)) + std::to_string(std::get<0>(row)); };
+
+	std::stringstream ss;
+	for (auto const& s : zip(v, l) | filter(is_even) | transform(to_string) | take(3)) {
+		ss << s << ' ';
+	}
+	ASSERT_EQ(ss.str(), "b2 d4 f6 ");
+
+	for (auto&& [i, c] : zip(v, l) | drop(6)) {
+		i = 0;
+		c = 'z';
+	}
+	ASSERT_EQ(v, (std::vector<int>{1, 2, 3, 4, 5, 6, 0, 0}));
+	ASSERT_EQ(l.back(), 'z');
+
+	auto listed {zip(v, l) | drop(2)};
+	ASSERT_TRUE(listed.begin() == listed.begin());
+	ASSERT_EQ(std::get<1>(*listed.begin()), 'c');
+	std::vector<char> w {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+	auto indexed {zip(v, w) | drop(5)};
+	ASSERT_EQ(std::get<1>(*indexed.begin()), 'f');
+	std::size_t rows {0u};
+	for ([[maybe_unused]] auto&& row : indexed) ++rows;
+	ASSERT_EQ(rows, 3u);
+
+	auto evens = std::vector<int>{1, 2, 3, 4, 5} | filter([](int i) { return i % 2 == 0; });
+	int sum {0};
+	for (int i : evens) sum += i;
+	ASSERT_EQ(sum, 6);
+
+	int count {0};
+	for ([[maybe_unused]] auto&& row : zip(v, l) | drop(100) | take(2)) ++count;
+	for ([[maybe_unused]] auto&& row : zip(v, l) | take(0)) ++count;
+	ASSERT_EQ(count, 0);
+}
+TEST(UnzipItertools, ColumnsFromRows) {
+	std::vector<int> v {1, 2, 3, 4};
+	std::list<char> l {'a', 'b', 'c', 'd', 'e'};
+
+	std::vector<int> ints;
+	std::string chars;
+	itertools::unzip_into(itertools::zip(v, l), ints, chars);
+	ASSERT_EQ(ints, v);
+	ASSERT_EQ(chars, "abcd");
+	ASSERT_EQ(ints.capacity(), 4u);
+
+	itertools::soa_vector<int, double> soa;
+	soa.push_back(5, .5);
+	soa.push_back(6, .25);
+	std::vector<double> doubles;
+	itertools::unzip_into(soa, ints, doubles);
+	ASSERT_EQ(ints, (std::vector<int>{1, 2, 3, 4, 5, 6}));
+	ASSERT_EQ(doubles, (std::vector<double>{.5, .25}));
+
+	std::vector<std::string> words;
+	std::list<int> odds;
+	auto const rows {std::vector<std::tuple<std::string, int>>{{"one", 1}, {"two", 2}, {"three", 3}}};
+	itertools::unzip_into(rows | itertools::filter([](auto const& row) { return std::get<1>(row) % 2 == 1; }), words, odds);
+	ASSERT_EQ(words, (std::vector<std::string>{"one", "three"}));
+	ASSERT_EQ(odds, (std::list<int>{1, 3}));
+
+	std::copy(rows.begin(), rows.end(), itertools::zip_back_inserter(words, odds));
+	ASSERT_EQ(words.size(), 5u);
+	ASSERT_EQ(odds.back(), 3);
+	auto inserter {itertools::zip_back_inserter(ints, chars)};
+	*inserter++ = std::make_tuple(7, 'z');
+	ASSERT_EQ(ints.back(), 7);
+	ASSERT_EQ(chars.back(), 'z');
+}
+TEST(EnumerateItertools, RowNumbers) {
+	static_assert(culib::requirements::isIterator_v<itertools::counting_iterator<int>>());
+#ifdef __cpp_concepts
+	static_assert(std::random_access_iterator<itertools::counting_iterator<>>);
+#endif
+	std::vector<int> v {10, 20, 30};
+	std::list<char> l {'a', 'b', 'c', 'd'};
+
+	auto zipper {itertools::enumerate(v, l)};
+	static_assert(decltype(zipper)::lead == 0u);
+	ASSERT_EQ(zipper.size(), 3u);
+
+	std::stringstream ss;
+	for (auto&& [n, i, c] : zipper) {
+		ss << n << ':' << i << c << ' ';
+		i = static_cast<int>(n);
+	}
+	ASSERT_EQ(ss.str(), "0:10a 1:20b 2:30c ");
+	ASSERT_EQ(v, (std::vector<int>{0, 1, 2}));
+
+	auto it {itertools::enumerate(v).begin()};
+	it += 2;
+	ASSERT_EQ(std::get<0>(*it), 2u);
+
+	itertools::counting_iterator<int> first {5}, last {9};
+	ASSERT_EQ(last - first, 4);
+	ASSERT_EQ(first[3], 8);
+	ASSERT_TRUE(first < last);
+	int sum {0};
+	for (auto n : itertools::counting_range<int>(1, 5)) sum += n;
+	ASSERT_EQ(sum, 10);
+}
+TEST(ParallelItertools, TransformReduceDeterministic) {
+	std::size_t const n {100'000u};
+	std::vector<double> prices (n);
+	std::vector<int> amounts (n);
+	for (std::size_t i = 0; i != n; ++i) {
+		prices[i] = 0.1 * static_cast<double>(i % 97);
+		amounts[i] = static_cast<int>(i % 13);
+	}
+	auto product = [](auto const& row) { return std::get<0>(row) * std::get<1>(row); };
+
+	itertools::thread_pool pool (3);
+	auto const pooled {itertools::transform_reduce(itertools::zip(prices, amounts), 0., std::plus<>{}, product, pool)};
+	auto const serial {itertools::transform_reduce(itertools::zip(prices, amounts), 0., std::plus<>{}, product, 1u)};
+	auto const wide {itertools::transform_reduce(itertools::zip(prices, amounts), 0., std::plus<>{}, product, 8u)};
+	ASSERT_EQ(pooled, serial);
+	ASSERT_EQ(wide, serial);
+	ASSERT_NEAR(serial, std::inner_product(prices.begin(), prices.end(), amounts.begin(), 0.), 1e-6);
+
+	std::list<int> l (amounts.begin(), amounts.begin() + 10);
+	ASSERT_EQ(itertools::transform_reduce(itertools::zip(l), 0, std::plus<>{}, [](auto const& row) { return std::get<0>(row); }, pool), 45);
+}
+TEST(ParallelItertools, InclusiveScanChunks) {
+	std::size_t const n {50'001u};
+	std::vector<long> values (n);
+	std::iota(values.begin(), values.end(), 1);
+	std::vector<long> expected (n);
+	std::partial_sum(values.begin(), values.end(), expected.begin());
+
+	std::vector<long> totals (n);
+	itertools::thread_pool pool (4);
+	auto const last {itertools::inclusive_scan(itertools::zip(values), totals.begin(), std::plus<>{}, pool)};
+	ASSERT_EQ(last, totals.end());
+	ASSERT_EQ(totals, expected);
+
+	std::vector<long> weighted (n);
+	itertools::inclusive_scan(itertools::zip(values, values), weighted.begin(), std::plus<>{},
+							  [](auto const& row) { return std::get<0>(row) - std::get<1>(row) + 1; }, 3u);
+	ASSERT_EQ(weighted.back(), static_cast<long>(n));
+
+	std::vector<long> counted (n);
+	itertools::inclusive_scan(itertools::zip(values), counted.begin(), std::plus<>{}, 2);
+	ASSERT_EQ(counted, expected);
+
+	std::list<long> l {1, 2, 3};
+	std::vector<long> small;
+	itertools::inclusive_scan(itertools::zip(l), std::back_inserter(small), std::plus<>{});
+	ASSERT_EQ(small, (std::vector<long>{1, 3, 6}));
+}
+TEST(ProductItertools, GridRows) {
+	std::vector<int> v {1, 2, 3};
+	auto grid {itertools::product(v, std::string("ab"))};
+	ASSERT_EQ(grid.size(), 6u);
+
+	std::stringstream ss;
+	for (auto const& [i, c] : grid) {
+		ss << i << c << ' ';
+	}
+	ASSERT_EQ(ss.str(), "1a 1b 2a 2b 3a 3b ");
+
+	auto it {grid.begin() + 4};
+	ASSERT_EQ(std::get<0>(*it), 3);
+	ASSERT_EQ(std::get<1>(*it), 'a');
+	ASSERT_EQ(std::get<1>(it[-1]), 'b');
+	ASSERT_EQ(grid.end() - it, 2);
+	--it;
+	ASSERT_EQ(it.offset<0>(), 1);
+	ASSERT_EQ(it.offset<1>(), 1);
+	ASSERT_TRUE(grid.begin() + 6 == grid.end());
+
+	std::list<char> l {'x', 'y'};
+	int count {0};
+	for (auto&& [x, i, y] : itertools::product(l, v, std::vector<char>{'p', 'q'})) {
+		if (x == 'y' && i == 3 && y == 'q') {
+			ASSERT_EQ(count, 11);
+		}
+		++count;
+	}
+	ASSERT_EQ(count, 12);
+	static_assert(std::is_same_v<decltype(itertools::product(l, v).begin())::iterator_category, std::forward_iterator_tag>);
+
+	for ([[maybe_unused]] auto&& row : itertools::product(v, std::vector<int>{})) {
+		FAIL();
+	}
+
+	std::atomic<int> sum {0};
+	itertools::parallel_for_each(itertools::product(v, v), [&sum](auto const& row) {
+		sum += std::get<0>(row) * std::get<1>(row);
+	}, 3u);
+	ASSERT_EQ(sum.load(), 36);
+}
+TEST(JoinItertools, MergeJoinModes) {
+	std::vector<int> left_keys {1, 2, 2, 4, 7};
+	std::string left_names {"abcde"};
+	std::vector<int> right_keys {2, 2, 3, 7, 8};
+	std::vector<double> right_values {.5, 1.5, 2.5, 3.5, 4.5};
+	auto key = [](auto const& row) { return std::get<0>(row); };
+
+	auto render = [](auto&& join) {
+		std::stringstream ss;
+		for (auto const& row : join) {
+			if (row.has_left()) ss << std::get<1>(row.left());
+			else ss << '-';
+			if (row.has_right()) ss << std::get<1>(row.right());
+			else ss << '-';
+			ss << ' ';
+		}
+		return ss.str();
+	};
+	auto left {itertools::zip(left_keys, left_names)};
+	auto right {itertools::zip(right_keys, right_values)};
+	ASSERT_EQ(render(itertools::merge_join(left, right, key, key)), "b0.5 b1.5 c0.5 c1.5 e3.5 ");
+	ASSERT_EQ(render(itertools::merge_join(left, right, key, key, itertools::join_mode::left_outer)),
+			  "a- b0.5 b1.5 c0.5 c1.5 d- e3.5 ");
+	ASSERT_EQ(render(itertools::merge_join(left, right, key, key, itertools::join_mode::full_outer)),
+			  "a- b0.5 b1.5 c0.5 c1.5 -2.5 d- e3.5 -4.5 ");
+
+	for (auto const& row : itertools::merge_join(left, right, key, key)) {
+		std::get<1>(row.left()) = '*';
+	}
+	ASSERT_EQ(left_names, "a**d*");
+
+	std::vector<int> sparse (1000);
+	std::iota(sparse.begin(), sparse.end(), 0);
+	std::map<int, char> const m {{-1, 'x'}, {500, 'y'}, {999, 'z'}, {1000, 'w'}};
+	int calls {0};
+	auto counted = [&calls](int i) { ++calls; return i; };
+	auto pair_key = [](auto const& key_value) { return key_value.first; };
+	std::stringstream ss;
+	for (auto const& row : itertools::merge_join(m, sparse, pair_key, counted)) {
+		ss << row.left().second << row.right() << ' ';
+	}
+	ASSERT_EQ(ss.str(), "y500 z999 ");
+	ASSERT_LT(calls, 100);
+
+	for ([[maybe_unused]] auto const& row : itertools::merge_join(std::vector<int>{}, sparse, counted, counted)) {
+		FAIL();
+	}
+}
+TEST(JoinItertools, HashJoinProbe) {
+	std::unordered_map<int, std::string> names {{1, "one"}, {3, "three"}, {4, "four"}, {40, "forty"}};
+	std::vector<int> ids {4, 2, 3, 3, 5, 1, 6, 7, 8, 9, 40};
+	std::vector<char> tags {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k'};
+	auto key = [](auto const& row) { return std::get<0>(row); };
+
+	std::stringstream ss;
+	for (auto&& [row, name] : itertools::hash_join<4>(itertools::zip(ids, tags), names, key)) {
+		ss << std::get<1>(row) << name << ' ';
+		name += '!';
+	}
+	ASSERT_EQ(ss.str(), "afour cthree dthree! fone kforty ");
+	ASSERT_EQ(names[3], "three!!");
+
+	auto const& const_names {names};
+	int count {0};
+	for (auto&& [id, name] : itertools::hash_join(ids, const_names, [](int id) { return id + 1; })) {
+		static_assert(std::is_same_v<decltype(name), std::string const&>);
+		ASSERT_EQ(name, names.at(id + 1));
+		++count;
+	}
+	ASSERT_EQ(count, 3);
+
+	for ([[maybe_unused]] auto&& row : itertools::hash_join<2>(ids, std::unordered_map<int, int>{}, [](int id) { return id; })) {
+		FAIL();
+	}
+	for ([[maybe_unused]] auto&& row : itertools::hash_join(std::vector<int>{}, names, [](int id) { return id; })) {
+		FAIL();
+	}
+}
+#ifdef ITERTOOLS_HAS_COROUTINES
+namespace {
+  itertools::generator<int, 4> numbers(int count, int* batches) {
+	  for (int i = 0; i != count; ++i) {
+		  if (i % 4 == 0) ++*batches;
+		  co_yield i;
+	  }
+  }
+
+  itertools::generator<std::string> words(std::string text) {
+	  std::istringstream in (text);
+	  for (std::string word; in >> word;) co_yield word;
+  }
+
+  itertools::generator<int> failing() {
+	  co_yield 1;
+	  throw std::runtime_error("decoder failure");
+  }
+}
+TEST(GeneratorItertools, ZipStreamingProducers) {
+	static_assert(culib::requirements::Iterator<itertools::generator<int>::iterator>);
+	static_assert(std::input_iterator<itertools::generator<int>::iterator>);
+
+	int batches {0};
+	std::vector<char> tags {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j'};
+	std::stringstream ss;
+	for (auto&& [i, w, t] : itertools::zip(numbers(9, &batches), words("zero one two three four five six"), tags)) {
+		ss << i << w << t << ' ';
+		t = '*';
+	}
+	ASSERT_EQ(ss.str(), "0zeroa 1oneb 2twoc 3threed 4foure 5fivef 6sixg ");
+	ASSERT_EQ(tags[6], '*');
+	ASSERT_EQ(tags[7], 'h');
+	ASSERT_EQ(batches, 2);
+
+	auto gen {numbers(10, &batches)};
+	int sum {0};
+	for (auto i : gen) sum += i;
+	ASSERT_EQ(sum, 45);
+	ASSERT_TRUE(gen.begin() == gen.end());
+
+	for ([[maybe_unused]] auto&& [i, v] : itertools::zip(numbers(0, &batches), tags)) {
+		FAIL();
+	}
+
+	auto broken {failing()};
+	auto it {broken.begin()};
+	ASSERT_EQ(*it, 1);
+	ASSERT_THROW(++it, std::runtime_error);
+}
+#endif
+TEST(SortItertools, SortByKeyColumn) {
+	std::vector<int> keys{ 5,3,1,4,2,3 };
+	std::vector<CopyCounter> names;
+	for (auto key : keys) names.emplace_back("name_" + std::to_string(key) + "_long_enough_not_to_be_small");
+	std::string tags { "edabcx" };
+	CopyCounter::copies = 0;
+
+	itertools::sort_by<0>(itertools::zip(keys, names, tags));
+	ASSERT_EQ(CopyCounter::copies, 0);
+	ASSERT_EQ(keys, (std::vector<int>{ 1,2,3,3,4,5 }));
+	for (auto const& [key, name, tag] : itertools::zip(keys, names, tags)) {
+		ASSERT_EQ(name.payload, "name_" + std::to_string(key) + "_long_enough_not_to_be_small");
+		ASSERT_TRUE(key != 3 || tag == 'd' || tag == 'x');
+	}
+
+	itertools::sort_by<2>(itertools::zip(keys, names, tags), std::greater<>{});
+	ASSERT_EQ(tags, "xedcba");
+	ASSERT_EQ(keys, (std::vector<int>{ 3,5,3,2,4,1 }));
+}
+TEST(SortItertools, ParallelSortByKeyColumn) {
+	std::size_t const n {100'003u};
+	std::vector<std::uint32_t> keys (n);
+	std::vector<std::uint64_t> payload (n);
+	std::uint32_t state {12345u};
+	for (std::size_t i = 0; i != n; ++i) {
+		state = state * 1664525u + 1013904223u;
+		keys[i] = state % 1000u;
+		payload[i] = keys[i] * 3u + 1u;
+	}
+
+	itertools::thread_pool pool (4u);
+	itertools::parallel_sort_by<0>(itertools::zip(keys, payload), std::less<>{}, pool);
+	ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+	for (std::size_t i = 0; i != n; ++i) {
+		ASSERT_EQ(payload[i], keys[i] * 3u + 1u);
+	}
+
+	itertools::soa_vector<int, char> soa;
+	for (int i = 0; i != 100; ++i) soa.push_back(i % 7, static_cast<char>('a' + i % 7));
+	itertools::parallel_sort_by<0>(soa, std::greater<>{}, 3u);
+	for (std::size_t i = 1; i != soa.size(); ++i) {
+		ASSERT_GE(std::get<0>(soa[i - 1]), std::get<0>(soa[i]));
+		ASSERT_EQ(std::get<1>(soa[i]), 'a' + std::get<0>(soa[i]));
+	}
+}
+TEST(BufferedItertools, StreamSources) {
+	std::istringstream numbers ("1 2 3 4 5 6 7 8 9 10");
+	std::istringstream words ("a b c d e f g h i");
+	auto zipped {itertools::buffered_zip<4>(
+			itertools::iterator_range(std::istream_iterator<int>(numbers), std::istream_iterator<int>()),
+			itertools::iterator_range(std::istream_iterator<std::string>(words), std::istream_iterator<std::string>()))};
+#ifdef __cpp_concepts
+	static_assert(std::input_iterator<decltype(zipped.begin())>);
+	static_assert(std::sentinel_for<decltype(zipped.end()), decltype(zipped.begin())>);
+#endif
+
+	std::stringstream ss;
+	for (auto&& [i, w] : zipped) {
+		ss << i << w << ' ';
+		i = 0;
+	}
+	ASSERT_EQ(ss.str(), "1a 2b 3c 4d 5e 6f 7g 8h 9i ");
+
+	std::vector<int> v {1, 2, 3};
+	std::istringstream letters ("a b c d e f g h");
+	{
+		auto shorter_first {itertools::buffered_zip<4>(v,
+				itertools::iterator_range(std::istream_iterator<std::string>(letters), std::istream_iterator<std::string>()))};
+		std::size_t rows {0u};
+		for (auto it = shorter_first.begin(); it != shorter_first.end(); ++it) ++rows;
+		ASSERT_EQ(rows, 3u);
+	}
+	// three letters are zipped, and the stream iterator has read one more ahead
+	std::string rest;
+	letters >> rest;
+	ASSERT_EQ(rest, "e");
+
+	std::istringstream longer ("a b c d e f g h i j k l m n o p");
+	{
+		auto longer_first {itertools::buffered_zip<4>(
+				itertools::iterator_range(std::istream_iterator<std::string>(longer), std::istream_iterator<std::string>()),
+				std::vector<int>{1, 2, 3})};
+		std::stringstream rows;
+		for (auto&& [w, i] : longer_first) rows << w << i << ' ';
+		ASSERT_EQ(rows.str(), "a1 b2 c3 ");
+	}
+	// one batch of four letters is read, and one more letter ahead, the short batch is the last one
+	longer >> rest;
+	ASSERT_EQ(rest, "f");
+
+	std::istringstream empty;
+	auto none {itertools::buffered_zip(v,
+			itertools::iterator_range(std::istream_iterator<int>(empty), std::istream_iterator<int>()))};
+	ASSERT_TRUE(none.begin() == none.end());
+}
+#ifdef ITERTOOLS_HAS_MMAP
+TEST(MmapColumn, ZipMappedColumns) {
+	auto const path {(std::filesystem::temp_directory_path() / "itertools_mmap_column_test.bin").string()};
+	{
+		std::ofstream out (path, std::ios::binary);
+		for (std::int32_t i = 1; i <= 5; ++i) out.write(reinterpret_cast<char const*>(&i), sizeof(i));
+	}
+	itertools::mmap_column<std::int32_t> const column (path, itertools::mmap_advice::sequential);
+	static_assert(culib::requirements::is_container_v<decltype(column)>);
+	ASSERT_EQ(column.size(), 5u);
+
+	std::string s { "abcd" };
+	std::stringstream ss;
+	for (auto const& [i, c] : itertools::zip(column, s)) {
+		ss << i << c << ' ';
+	}
+	ASSERT_EQ(ss.str(), "1a 2b 3c 4d ");
+
+	auto const output_path {path + ".out"};
+	{
+		itertools::mmap_output_column<double> output (output_path, column.size());
+		for (auto&& [in, out] : itertools::zip(column, output)) {
+			out = in * .5;
+		}
+		output.sync();
+	}
+	itertools::mmap_column<double> doubles (output_path);
+	ASSERT_EQ(doubles.size(), 5u);
+	ASSERT_EQ(doubles[4], 2.5);
+
+	auto moved {std::move(doubles)};
+	ASSERT_TRUE(doubles.empty());
+	ASSERT_EQ(std::accumulate(moved.begin(), moved.end(), 0.), 7.5);
+
+	std::filesystem::remove(path);
+	std::filesystem::remove(output_path);
+	ASSERT_THROW(itertools::mmap_column<int>{path}, std::system_error);
+}
+#endif
+TEST(ChunksItertools, BlocksAndTail) {
+	std::vector<float> v (10u);
+	std::iota(v.begin(), v.end(), 0.f);
+	std::string const s { "abcdefghijklmn" };
+	std::array<int, 11> a {};
+
+	auto zipper = itertools::zip(v, s, a);
+	auto chunks = zipper.chunks<4>();
+	ASSERT_EQ(chunks.size(), 2u);
+
+	std::size_t offset {0u};
+	for (auto const& [floats, chars, ints] : chunks) {
+		ASSERT_EQ(floats.size(), 4u);
+		for (std::size_t i = 0; i != 4u; ++i) {
+			ASSERT_EQ(floats[i], static_cast<float>(offset + i));
+			ASSERT_EQ(chars[i], s[offset + i]);
+			ints[i] = static_cast<int>(floats[i]) * 2;
+		}
+		offset += 4u;
+	}
+	ASSERT_EQ(offset, 8u);
+
+	std::stringstream ss;
+	for (auto const& [f, c, i] : chunks.tail()) {
+		ss << f << ' ' << c << ' ' << i << '\n';
+	}
+	std::string check {R"(8 i 0
+9 j 0
+)"};
+	ASSERT_EQ(ss.str(), check);
+	ASSERT_EQ(a[7], 14);
+}
+namespace {
+	template<typename Zip, typename = void>
+	struct HasChunks : std::false_type {};
+	template<typename Zip>
+	struct HasChunks<Zip, std::void_t<decltype(std::declval<Zip>().template chunks<2>())>> : std::true_type {};
+}
+TEST(ChunksItertools, ShorterThanWidth) {
+	std::vector<int> v{ 1,2,3 };
+	std::vector<int> w;
+
+	auto chunks = itertools::zip(v).chunks<8>();
+	ASSERT_EQ(chunks.size(), 0u);
+	ASSERT_TRUE(chunks.begin() == chunks.end());
+	int sum {0};
+	for (auto const& [i] : chunks.tail()) sum += i;
+	ASSERT_EQ(sum, 6);
+
+	auto empty = itertools::zip(v, w).chunks<2>();
+	ASSERT_TRUE(empty.begin() == empty.end());
+	ASSERT_TRUE(empty.tail().begin() == empty.tail().end());
+
+	// the blocks of a temporary zip, that owns a container, would dangle
+	auto owning = itertools::zip(std::vector<int>{1, 2, 3, 4});
+	static_assert(!HasChunks<decltype(owning)>::value);
+	static_assert(HasChunks<decltype(owning)&>::value);
+	static_assert(HasChunks<decltype(itertools::zip(v))>::value);
+	sum = 0;
+	for (auto const& [block] : owning.chunks<2>()) sum += block[0] * block[1];
+	ASSERT_EQ(sum, 14);
+}
+TEST(SoaVector, PushBackAndIterate) {
+	itertools::soa_vector<int, std::string, double> soa;
+	ASSERT_TRUE(soa.empty());
+	soa.reserve(2u);
+	ASSERT_EQ(soa.capacity(), 2u);
+
+	for (int i = 0; i != 10; ++i) {
+		soa.push_back(i, std::to_string(i), i * 0.5);
+	}
+	ASSERT_EQ(soa.size(), 10u);
+	ASSERT_GE(soa.capacity(), 10u);
+
+	int count {0};
+	for (auto&& [i, s, d] : soa) {
+		ASSERT_EQ(s, std::to_string(i));
+		ASSERT_EQ(d, i * 0.5);
+		s += '!';
+		++count;
+	}
+	ASSERT_EQ(count, 10);
+	ASSERT_EQ(std::get<1>(soa[3]), "3!");
+	ASSERT_EQ(soa.data<0>()[9], 9);
+	ASSERT_THROW(soa.at(10u), std::out_of_range);
+}
+TEST(SoaVector, CopyMoveAndAliasing) {
+	itertools::soa_vector<std::string, int> soa;
+	soa.push_back("first", 1);
+	ASSERT_EQ(soa.capacity(), 1u);
+	soa.push_back(std::get<0>(soa[0]), std::get<1>(soa[0]));
+	ASSERT_EQ(std::get<0>(soa[1]), "first");
+
+	auto copy {soa};
+	auto moved {std::move(soa)};
+	ASSERT_EQ(copy.size(), 2u);
+	ASSERT_EQ(moved.size(), 2u);
+	ASSERT_TRUE(soa.empty());
+
+	moved.pop_back();
+	moved.resize(3u);
+	ASSERT_EQ(moved.size(), 3u);
+	ASSERT_EQ(std::get<1>(moved[2]), 0);
+	ASSERT_EQ(std::get<1>(copy[1]), 1);
+}
+namespace {
+  /**
+   * @details
+   * Copyable, with a move that may throw, so it is copied\n
+   * on the reallocation, and the copy number countdown throws.\n
+   * */
+  struct ThrowingCopy {
+	  static inline int countdown {-1};
+	  static inline int alive {0};
+	  std::string payload;
+
+	  explicit ThrowingCopy(std::string payload) : payload (std::move(payload)) { ++alive; }
+	  ThrowingCopy(ThrowingCopy const& other) : payload (other.payload) {
+		  if (--countdown == 0) throw std::runtime_error("copy failure");
+		  ++alive;
+	  }
+	  ThrowingCopy(ThrowingCopy&& other) : payload (std::move(other.payload)) { ++alive; }
+	  ~ThrowingCopy() { --alive; }
+  };
+}
+TEST(SoaVector, StrongGuaranteeOnReallocation) {
+	static_assert(!std::is_nothrow_move_constructible_v<ThrowingCopy>);
+	{
+		itertools::soa_vector<std::string, ThrowingCopy> soa;
+		soa.reserve(4u);
+		for (int i = 0; i != 4; ++i) {
+			soa.emplace_back(std::string(32u, 'a' + i), ThrowingCopy(std::string(32u, 'A' + i)));
+		}
+		ASSERT_EQ(ThrowingCopy::alive, 4);
+
+		ThrowingCopy::countdown = 3;
+		ASSERT_THROW(soa.emplace_back(std::string(32u, 'e'), ThrowingCopy(std::string(32u, 'E'))), std::runtime_error);
+		ASSERT_EQ(soa.size(), 4u);
+		ASSERT_EQ(soa.capacity(), 4u);
+		ASSERT_EQ(ThrowingCopy::alive, 4);
+		for (int i = 0; i != 4; ++i) {
+			ASSERT_EQ(std::get<0>(soa[i]), std::string(32u, 'a' + i));
+			ASSERT_EQ(std::get<1>(soa[i]).payload, std::string(32u, 'A' + i));
+		}
+
+		ThrowingCopy::countdown = 2;
+		ASSERT_THROW(soa.reserve(16u), std::runtime_error);
+		ASSERT_EQ(soa.capacity(), 4u);
+		ASSERT_EQ(ThrowingCopy::alive, 4);
+
+		ThrowingCopy::countdown = -1;
+		soa.reserve(16u);
+		ASSERT_EQ(soa.capacity(), 16u);
+		ASSERT_EQ(std::get<1>(soa[3]).payload, std::string(32u, 'D'));
+	}
+	ASSERT_EQ(ThrowingCopy::alive, 0);
+}
+TEST(SoaVector, ZipWithOthers) {
+	itertools::soa_vector<int, char> soa;
+	soa.push_back(1, 'a');
+	soa.push_back(2, 'b');
+	std::vector<int> v{ 10, 20, 30 };
+
+	std::stringstream ss;
+	for (auto const& [row, i] : itertools::zip(std::as_const(soa), v)) {
+		auto const& [j, c] = row;
+		ss << j << c << i << '\n';
+	}
+	std::string check {R"(1a10
+2b20
+)"};
+	ASSERT_EQ(ss.str(), check);
+}
 
-int main() {
-	testing::InitGoogleTest();
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
 	testing::GTEST_FLAG(color) = "yes";
 
 	return RUN_ALL_TESTS();
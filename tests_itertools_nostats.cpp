@@ -0,0 +1,39 @@
+//
+// Created by Andrey Solovyev on 17/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "itertools.hpp"
+#include <vector>
+#include <list>
+
+/**
+ * @details
+ * Same zips as the ones of tests_itertools.cpp, but with\n
+ * ITERTOOLS_STATS not defined - the default build path.\n
+ * */
+TEST(StatsItertools, CountersCompiledOut) {
+	static_assert(!itertools::base::utils::stats_enabled);
+
+	std::vector<int> v {1, 2, 3, 4};
+	std::list<char> l {'a', 'b', 'c', 'd', 'e'};
+	int sum {0};
+	for (auto const& [i, c] : itertools::zip(v, l)) {
+		sum += i + c;
+	}
+	ASSERT_EQ(sum, 10 + 'a' + 'b' + 'c' + 'd');
+
+	auto it {itertools::zip(v, l).begin()};
+	it += 3;
+	auto&& [i, c] = it;
+	ASSERT_EQ(i + c, 4 + 'd');
+
+	auto const& counters {itertools::stats()};
+	ASSERT_EQ(counters.increments, 0u);
+	ASSERT_EQ(counters.decrements, 0u);
+	ASSERT_EQ(counters.advances, 0u);
+	ASSERT_EQ(counters.comparisons, 0u);
+	ASSERT_EQ(counters.dereferences, 0u);
+	ASSERT_EQ(counters.gets, 0u);
+}
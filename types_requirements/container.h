@@ -50,6 +50,44 @@ namespace culib::requirements {
   template<typename... MaybeContainer>
   using NotAreAllContainers = std::enable_if_t<!areAllContainers_v<MaybeContainer...>(), bool>;
 
+  namespace details {
+	template<typename Container, typename = void>
+	struct MaybeSized : std::false_type { };
+
+	template<typename Container>
+	struct MaybeSized<Container,
+					  std::void_t<
+							  decltype(std::declval<Container>().size())
+					  >
+	> : std::true_type {};
+  }//!namespace
+  template<typename Container>
+  inline constexpr bool is_sized_v { details::MaybeSized<Container>::value };
+
+  template<typename Container>
+  using IsSized = std::enable_if_t<is_sized_v<Container>, bool>;
+
+  namespace details {
+	template<typename Container, typename = void>
+	struct MaybeContiguous : std::false_type { };
+
+	template<typename Container>
+	struct MaybeContiguous<Container,
+						   std::void_t<
+								   decltype(std::declval<Container>().data()),
+								   decltype(std::declval<Container>().size())
+						   >
+	> : std::is_pointer<decltype(std::declval<Container>().data())> {};
+  }//!namespace
+  template<typename Container>
+  inline constexpr bool is_contiguous_v { details::MaybeContiguous<Container>::value };
+
+  template<typename... MaybeContiguous>
+  constexpr bool areAllContiguous_v () {
+	  bool result {true};
+	  return ((result = result && is_contiguous_v<MaybeContiguous>),...);
+  }
+
   template<typename Element>
   using IsDefaultConstructible = std::enable_if_t<std::is_default_constructible_v<Element>, bool>;
 
@@ -67,6 +105,29 @@ namespace culib::requirements {
   template<typename... MaybeContainer>
   concept AreAllContainers = requires () {requires ((IsContainer<MaybeContainer>),...);};
 
+  template<typename C>
+  concept IsSized = requires (C c) {
+	  c.size();
+  };
+
+  template<typename C>
+  inline constexpr bool is_sized_v { IsSized<C> ? true : false };
+
+  template<typename C>
+  concept IsContiguous = requires (C c) {
+	  c.size();
+	  requires std::is_pointer_v<decltype(c.data())>;
+  };
+
+  template<typename C>
+  inline constexpr bool is_contiguous_v { IsContiguous<C> ? true : false };
+
+  template<typename... MaybeContiguous>
+  concept AreAllContiguous = requires () {requires ((IsContiguous<MaybeContiguous>),...);};
+
+  template<typename... MaybeContiguous>
+  constexpr bool areAllContiguous_v () { return AreAllContiguous<MaybeContiguous...>; }
+
 #endif
 
 
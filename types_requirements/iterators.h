@@ -33,11 +33,11 @@ namespace culib::requirements {
 
   template <typename I>
   concept Iterator = requires() {
-	  typename I::value_type;
-	  typename I::difference_type;
-	  typename I::reference;
-	  typename I::pointer;
-	  typename I::iterator_category;
+	  typename std::iterator_traits<I>::value_type;
+	  typename std::iterator_traits<I>::difference_type;
+	  typename std::iterator_traits<I>::reference;
+	  typename std::iterator_traits<I>::pointer;
+	  typename std::iterator_traits<I>::iterator_category;
   };
   template <typename I>
   concept NotIterator = !Iterator<I>;
@@ -52,22 +52,22 @@ namespace culib::requirements {
 
   template <typename I>
   concept InputIterator = Iterator<I> && requires {
-	  typename I::iterator_category;
-  } && DerivedFrom<typename I::iterator_category, std::input_iterator_tag>;
+	  typename std::iterator_traits<I>::iterator_category;
+  } && DerivedFrom<typename std::iterator_traits<I>::iterator_category, std::input_iterator_tag>;
 
   template <typename I>
   concept ForwardIterator =
   InputIterator<I> && Incrementable<I> &&
-		  DerivedFrom<typename I::iterator_category, std::forward_iterator_tag>;
+		  DerivedFrom<typename std::iterator_traits<I>::iterator_category, std::forward_iterator_tag>;
 
 
   template <typename I>
   concept BidirectionalIterator =
   ForwardIterator<I> && Decrementable<I> &&
-		  DerivedFrom<typename I::iterator_category, std::bidirectional_iterator_tag>;
+		  DerivedFrom<typename std::iterator_traits<I>::iterator_category, std::bidirectional_iterator_tag>;
 
   template <typename I>
-  concept RandomAccess = requires(I it, typename I::difference_type n) {
+  concept RandomAccess = requires(I it, typename std::iterator_traits<I>::difference_type n) {
 	  it + n;
 	  it - n;
   };
@@ -75,7 +75,7 @@ namespace culib::requirements {
   template <typename I>
   concept RandomAccessIterator =
   BidirectionalIterator<I> && RandomAccess<I> &&
-		  DerivedFrom<typename I::iterator_category, std::random_access_iterator_tag>;
+		  DerivedFrom<typename std::iterator_traits<I>::iterator_category, std::random_access_iterator_tag>;
 
   /** @brief
    * Block of code, written by Konstantin Valdimirov,\n
@@ -95,6 +95,11 @@ namespace culib::requirements {
 	  return result;
   }
 
+  template <typename... Iters>
+  inline constexpr bool areAllContiguousIterators_v (){
+	  return (std::contiguous_iterator<Iters> && ...);
+  }
+
 
 
 #else
@@ -104,11 +109,11 @@ namespace culib::requirements {
 
   template <typename Iter>
   struct MaybeIterator <Iter, std::void_t<
-		  typename Iter::value_type,
-		  typename Iter::difference_type,
-		  typename Iter::reference,
-		  typename Iter::pointer,
-		  typename Iter::iterator_category>> : std::true_type {};
+		  typename std::iterator_traits<Iter>::value_type,
+		  typename std::iterator_traits<Iter>::difference_type,
+		  typename std::iterator_traits<Iter>::reference,
+		  typename std::iterator_traits<Iter>::pointer,
+		  typename std::iterator_traits<Iter>::iterator_category>> : std::true_type {};
 
   template <typename Iter>
   constexpr bool isIterator_v () { return MaybeIterator<Iter>::value; }
@@ -157,9 +162,9 @@ namespace culib::requirements {
   struct RandomAccessType : std::false_type {} ;
   template <typename I>
   struct RandomAccessType<I, std::void_t<
-		  decltype(std::declval<I::difference_type>()),
-		  decltype(std::declval<I>() + std::declval<I::difference_type>()),
-		  decltype(std::declval<I>() - std::declval<I::difference_type>())>
+		  decltype(std::declval<typename std::iterator_traits<I>::difference_type>()),
+		  decltype(std::declval<I>() + std::declval<typename std::iterator_traits<I>::difference_type>()),
+		  decltype(std::declval<I>() - std::declval<typename std::iterator_traits<I>::difference_type>())>
   > : std::true_type {};
 
   template <typename I>
@@ -209,6 +214,16 @@ namespace culib::requirements {
 	  return result;
   }
 
+  /**
+   * @details
+   * There is no contiguous iterator category before C++20,\n
+   * so only the raw pointers are known to be contiguous.\n
+   * */
+  template <typename... Iters>
+  inline constexpr bool areAllContiguousIterators_v (){
+	  return (std::is_pointer_v<Iters> && ...);
+  }
+
 
 #endif
 